@@ -0,0 +1,215 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief benchmark the candidate pairs generated by a BlockingIndex when
+ *  reconciling two synthetic catalogs of names
+ *  @details usage: NameBlockingBenchmark [catalogSize]
+ *  the second catalog holds a copy of each name of the first with random
+ *  typing errors, in a different order. Recall is the fraction of the copies
+ *  whose original is among the candidates
+ */
+
+#include "gmlc/utilities/BlockingIndex.h"
+#include "gmlc/utilities/similarity.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace gmlc::utilities::similarity;
+
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+double secondsSince(clock_type::time_point start)
+{
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+std::string makeWord(std::mt19937& gen)
+{
+    static const std::vector<std::string> syllables{
+        "an",  "ber", "cal", "do",  "el",  "fin", "gar", "ha",  "is",
+        "jo",  "ka",  "lin", "mar", "ne",  "ol",  "per", "qui", "ro",
+        "sen", "ta",  "ur",  "va",  "wil", "xi",  "yo",  "zel", "ton",
+        "son", "ley", "ric", "sha", "mo",  "th",  "ch",  "ph",  "ck"};
+    std::uniform_int_distribution<int> count(2, 4);
+    std::string word;
+    const int syllableCount = count(gen);
+    for (int ii = 0; ii < syllableCount; ++ii) {
+        word += syllables[gen() % syllables.size()];
+    }
+    word.front() = static_cast<char>(word.front() - 'a' + 'A');
+    return word;
+}
+
+std::string makeName(std::mt19937& gen)
+{
+    std::string name = makeWord(gen);
+    if (gen() % 4 == 0) {
+        name.push_back(' ');
+        name.push_back(static_cast<char>('A' + gen() % 26));
+        name.push_back('.');
+    }
+    name.push_back(' ');
+    name += makeWord(gen);
+    return name;
+}
+
+/** apply 0 to 2 random edits to a name*/
+std::string addErrors(std::string name, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> letter('a', 'z');
+    const auto edits = gen() % 3;
+    for (unsigned int edit = 0; edit < edits && name.size() > 2; ++edit) {
+        const std::size_t position = gen() % (name.size() - 1);
+        switch (gen() % 4) {
+            case 0:
+                name[position] = static_cast<char>(letter(gen));
+                break;
+            case 1:
+                name.erase(position, 1);
+                break;
+            case 2:
+                name.insert(position, 1, static_cast<char>(letter(gen)));
+                break;
+            default:
+                std::swap(name[position], name[position + 1]);
+                break;
+        }
+    }
+    return name;
+}
+
+struct Setting {
+    const char* name;
+    BlockingOptions options;
+};
+
+BlockingOptions makeOptions(
+    std::size_t qgramSize,
+    double overlap,
+    bool phonetic,
+    double lengthTolerance)
+{
+    BlockingOptions options;
+    options.qgramKeys = (qgramSize > 0);
+    if (qgramSize > 0) {
+        options.qgramSize = qgramSize;
+    }
+    options.minimumQGramOverlap = overlap;
+    options.soundexKeys = phonetic;
+    options.metaphoneKeys = phonetic;
+    options.lengthTolerance = lengthTolerance;
+    return options;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t count =
+        (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 20000U;
+    std::mt19937 gen(20261019);
+    std::vector<std::string> catalog(count);
+    for (auto& name : catalog) {
+        name = makeName(gen);
+    }
+    // the queries are the names with errors in a random order
+    std::vector<std::size_t> source(count);
+    std::iota(source.begin(), source.end(), std::size_t{0});
+    std::shuffle(source.begin(), source.end(), gen);
+    std::vector<std::string> queries(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        queries[ii] = addErrors(catalog[source[ii]], gen);
+    }
+    const std::vector<std::string_view> catalogViews(
+        catalog.begin(), catalog.end());
+    const std::vector<std::string_view> queryViews(
+        queries.begin(), queries.end());
+
+    // estimate the cost of comparing every pair from a sample of queries
+    const std::size_t sampleSize = (std::min)(count, std::size_t{200});
+    auto start = clock_type::now();
+    double checksum{0.0};
+    for (std::size_t ii = 0; ii < sampleSize; ++ii) {
+        const JaroWinklerPattern pattern(queryViews[ii]);
+        const auto scores = pattern.similarity(catalogViews);
+        checksum += *std::max_element(scores.begin(), scores.end());
+    }
+    const double exhaustive = secondsSince(start) *
+        static_cast<double>(count) / static_cast<double>(sampleSize);
+    std::printf(
+        "%zu x %zu names, all pairs with jaroWinkler: %.1f s (estimated)\n\n",
+        count,
+        count,
+        exhaustive);
+
+    const std::vector<Setting> settings{
+        {"2-grams 50%", makeOptions(2, 0.5, false, 0.5)},
+        {"2-grams 70%", makeOptions(2, 0.7, false, 0.5)},
+        {"3-grams 50%", makeOptions(3, 0.5, false, 0.5)},
+        {"phonetic words", makeOptions(0, 0.5, true, 0.5)},
+        {"3-grams 50% + phonetic", makeOptions(3, 0.5, true, 0.5)},
+        {"2-grams 70% + phonetic", makeOptions(2, 0.7, true, 0.25)}};
+    std::printf(
+        "%-26s %8s %9s %12s %8s %9s %9s\n",
+        "blocking keys",
+        "build s",
+        "search s",
+        "pairs/query",
+        "recall",
+        "score s",
+        "speedup");
+    for (const auto& setting : settings) {
+        start = clock_type::now();
+        const BlockingIndex index(catalogViews, setting.options);
+        const double build = secondsSince(start);
+
+        start = clock_type::now();
+        const auto pairs = index.candidatePairs(queryViews);
+        const double search = secondsSince(start);
+
+        std::size_t found{0};
+        for (const auto& pair : pairs) {
+            if (source[pair.queryIndex] == pair.catalogIndex) {
+                ++found;
+            }
+        }
+        start = clock_type::now();
+        std::size_t pairIndex{0};
+        while (pairIndex < pairs.size()) {
+            const std::size_t query = pairs[pairIndex].queryIndex;
+            const JaroWinklerPattern pattern(queryViews[query]);
+            for (; pairIndex < pairs.size() &&
+                 pairs[pairIndex].queryIndex == query;
+                 ++pairIndex) {
+                checksum += pattern.similarity(
+                    catalogViews[pairs[pairIndex].catalogIndex]);
+            }
+        }
+        const double score = secondsSince(start);
+        std::printf(
+            "%-26s %8.2f %9.2f %12.1f %7.2f%% %9.2f %8.0fx\n",
+            setting.name,
+            build,
+            search,
+            static_cast<double>(pairs.size()) / static_cast<double>(count),
+            100.0 * static_cast<double>(found) / static_cast<double>(count),
+            score,
+            exhaustive / (build + search + score));
+    }
+    std::printf("\n(checksum %g)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief benchmark the numeric conversion functions against strtod,
+ *  std::from_chars and the previous std::stod based conversion
+ *  @details usage: NumericConversionBenchmark [locale] [fieldCount]
+ *  if a locale is given it is set as LC_NUMERIC before running so the effect of
+ *  the locale on each method can be seen
+ */
+
+#include "gmlc/utilities/stringConversion.h"
+#include "gmlc/utilities/string_viewConversion.h"
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+namespace {
+using fieldSet = std::vector<std::string>;
+
+std::string makeInteger(std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> digits(1, 10);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::string field;
+    if (gen() % 4 == 0) {
+        field.push_back('-');
+    }
+    const int count = digits(gen);
+    for (int ii = 0; ii < count; ++ii) {
+        field.push_back(static_cast<char>('0' + digit(gen)));
+    }
+    return field;
+}
+
+std::string makeDecimal(std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> fraction(1, 6);
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::string field = makeInteger(gen);
+    field.push_back('.');
+    const int count = fraction(gen);
+    for (int ii = 0; ii < count; ++ii) {
+        field.push_back(static_cast<char>('0' + digit(gen)));
+    }
+    return field;
+}
+
+std::string makeScientific(std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> mantissa(-10.0, 10.0);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::array<char, 48> buffer{};
+    std::snprintf(
+        buffer.data(),
+        buffer.size(),
+        "%.9e",
+        mantissa(gen) * std::pow(10.0, exponent(gen)));
+    return {buffer.data()};
+}
+
+std::string makeInvalid(std::mt19937& gen)
+{
+    static const std::vector<std::string> invalid{
+        "N/A", "", "null", "-", "abc", "12x", "1.2.3", "--5", "#VALUE!", "?"};
+    return invalid[gen() % invalid.size()];
+}
+
+fieldSet generateFields(
+    std::size_t count,
+    const std::function<std::string(std::mt19937&)>& generator)
+{
+    std::mt19937 gen(4572);
+    fieldSet fields;
+    fields.reserve(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        fields.push_back(generator(gen));
+    }
+    return fields;
+}
+
+std::string makeDirty(std::mt19937& gen)
+{
+    const auto selector = gen() % 10;
+    if (selector < 3) {
+        return makeInvalid(gen);
+    }
+    if (selector < 5) {
+        return makeInteger(gen);
+    }
+    if (selector < 8) {
+        return makeDecimal(gen);
+    }
+    return makeScientific(gen);
+}
+
+/** the std::string conversion before it was made locale independent*/
+double oldConversion(const std::string& field, double defValue)
+{
+    if (nonNumericFirstCharacter(field)) {
+        return defValue;
+    }
+    try {
+        return std::stod(field);
+    }
+    catch (const std::invalid_argument&) {
+        return defValue;
+    }
+    catch (const std::out_of_range&) {
+        return defValue;
+    }
+}
+
+double strtodConversion(const std::string& field, double defValue)
+{
+    char* endPtr{nullptr};
+    const double val = std::strtod(field.c_str(), &endPtr);
+    return (endPtr == field.c_str()) ? defValue : val;
+}
+
+double fromCharsConversion(const std::string& field, double defValue)
+{
+    double val{defValue};
+    auto res = std::from_chars(field.data(), field.data() + field.size(), val);
+    return (res.ec == std::errc{}) ? val : defValue;
+}
+
+double stringConversion(const std::string& field, double defValue)
+{
+    try {
+        return numeric_conversion<double>(field, defValue);
+    }
+    catch (const std::out_of_range&) {
+        return defValue;
+    }
+}
+
+double stringViewConversion(const std::string& field, double defValue)
+{
+    try {
+        return numeric_conversion<double>(std::string_view(field), defValue);
+    }
+    catch (const std::out_of_range&) {
+        return defValue;
+    }
+}
+
+double tryConversion(const std::string& field, double defValue)
+{
+    return tryNumericConversion<double>(field).value_or(defValue);
+}
+
+struct Method {
+    const char* name;
+    double (*conversion)(const std::string&, double);
+};
+
+void runBenchmark(const char* setName, const fieldSet& fields, int repeats)
+{
+    static const std::vector<Method> methods{
+        {"old std::stod path", oldConversion},
+        {"strtod", strtodConversion},
+        {"std::from_chars", fromCharsConversion},
+        {"numeric_conversion(string)", stringConversion},
+        {"numeric_conversion(string_view)", stringViewConversion},
+        {"tryNumericConversion", tryConversion}};
+
+    std::vector<double> reference(fields.size());
+    for (std::size_t ii = 0; ii < fields.size(); ++ii) {
+        reference[ii] = fromCharsConversion(fields[ii], -1.0);
+    }
+    std::printf("%s (%zu fields)\n", setName, fields.size());
+    for (const auto& method : methods) {
+        double checksum{0.0};
+        std::size_t mismatches{0};
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repeats; ++rep) {
+            for (const auto& field : fields) {
+                checksum += method.conversion(field, -1.0);
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        for (std::size_t ii = 0; ii < fields.size(); ++ii) {
+            if (method.conversion(fields[ii], -1.0) != reference[ii]) {
+                ++mismatches;
+            }
+        }
+        const double nsPerField =
+            std::chrono::duration<double, std::nano>(stop - start).count() /
+            static_cast<double>(fields.size() * static_cast<size_t>(repeats));
+        std::printf(
+            "  %-34s %8.2f ns/field  %6zu differ from from_chars  (%g)\n",
+            method.name,
+            nsPerField,
+            mismatches,
+            checksum);
+    }
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1) {
+        if (std::setlocale(LC_NUMERIC, argv[1]) == nullptr) {
+            std::printf("unable to set locale %s\n", argv[1]);
+            return 1;
+        }
+    }
+    const std::size_t count =
+        (argc > 2) ? static_cast<std::size_t>(std::atol(argv[2])) : 200000U;
+    const char* localeName = std::setlocale(LC_NUMERIC, nullptr);
+    std::printf(
+        "LC_NUMERIC=%s\n", (localeName != nullptr) ? localeName : "unknown");
+
+    const int repeats{5};
+    runBenchmark("integers", generateFields(count, makeInteger), repeats);
+    runBenchmark("decimals", generateFields(count, makeDecimal), repeats);
+    runBenchmark("scientific", generateFields(count, makeScientific), repeats);
+    runBenchmark(
+        "dirty fields (30% invalid)",
+        generateFields(count, makeDirty),
+        repeats);
+    return 0;
+}
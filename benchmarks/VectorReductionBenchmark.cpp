@@ -0,0 +1,315 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief compare the vectorOps kernels with straightforward loops
+ *  @details each row times a scalar version and the library version of the
+ *  same operation: the reductions, describe, vecFind, a fused expression,
+ *  compareWithTolerance, the batched 4x4 solver and interpolation with sorted
+ *  and unsorted times
+ *  usage: VectorReductionBenchmark [elementCount]
+ *  the default size fits in the L2 cache so the arithmetic is measured
+ *  rather than the memory bandwidth
+ */
+
+#include "gmlc/utilities/interpolation.hpp"
+#include "gmlc/utilities/smallSolvers.hpp"
+#include "gmlc/utilities/vectorCompare.hpp"
+#include "gmlc/utilities/vectorExpressions.hpp"
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/** time repeated calls of a reduction in nanoseconds per element*/
+template<class Function>
+double timePerElement(std::size_t count, Function function, double& checksum)
+{
+    const std::size_t repeats = (std::max)(
+        std::size_t{1}, static_cast<std::size_t>(200000000) / (count + 1));
+    const auto start = clock_type::now();
+    for (std::size_t ii = 0; ii < repeats; ++ii) {
+        checksum += static_cast<double>(function());
+    }
+    const double seconds =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    return seconds * 1e9 / static_cast<double>(repeats * count);
+}
+
+template<class X>
+void compare(const char* typeName, const std::vector<X>& data)
+{
+    const std::span<const X> view(data);
+    double checksum{0.0};
+    const auto sequential = [&](auto function) {
+        return timePerElement(data.size(), function, checksum);
+    };
+    const struct {
+        const char* name;
+        double before;
+        double after;
+    } rows[] = {
+        {"sum",
+         sequential([&] { return vectorOpsDetail::sum<X>(view); }),
+         sequential([&] { return sum(view, reduction_order::reassociate); })},
+        {"absSum",
+         sequential([&] { return vectorOpsDetail::absSum<X>(view); }),
+         sequential(
+             [&] { return absSum(view, reduction_order::reassociate); })},
+        {"rms",
+         sequential([&] { return vectorOpsDetail::rms<X>(view); }),
+         sequential([&] { return rms(view, reduction_order::reassociate); })},
+        {"absMax",
+         sequential([&] { return vectorOpsDetail::absMax<X>(view); }),
+         sequential([&] { return absMax(view); })},
+        {"absMin",
+         sequential([&] {
+             return vectorOpsDetail::bestLoc<X>(
+                        view, vectorOpsDetail::absValue<X>, std::less<X>())
+                 .first;
+         }),
+         sequential([&] { return absMin(view); })}};
+    for (const auto& row : rows) {
+        std::printf(
+            "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+            typeName,
+            row.name,
+            row.before,
+            row.after,
+            row.before / row.after);
+    }
+    if constexpr (std::is_floating_point_v<X>) {
+        // the statistics from separate calls against a single describe pass
+        const double separate = sequential([&] {
+            return sum(view) + stdev(view) + rms(view) + absMaxLoc(view).first +
+                *std::min_element(view.begin(), view.end()) +
+                *std::max_element(view.begin(), view.end());
+        });
+        const double fused = sequential([&] {
+            const auto summary = describe(view);
+            return summary.sum + summary.stdev + summary.rms + summary.absMax +
+                summary.min + summary.max;
+        });
+        std::printf(
+            "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+            typeName,
+            "describe",
+            separate,
+            fused,
+            separate / fused);
+    }
+    // finding about 1 in 4 values against the scalar push_back loop
+    const X threshold = static_cast<X>(
+        *std::max_element(view.begin(), view.end()) / 2);
+    const double scalarFind = sequential([&] {
+        std::vector<std::size_t> locs;
+        for (std::size_t ii = 0; ii < view.size(); ++ii) {
+            if (view[ii] > threshold) {
+                locs.push_back(ii);
+            }
+        }
+        return locs.size();
+    });
+    const double maskFind =
+        sequential([&] { return vecFindgt(view, threshold).size(); });
+    std::printf(
+        "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+        typeName,
+        "vecFind",
+        scalarFind,
+        maskFind,
+        scalarFind / maskFind);
+    // a*b + c*d with chained calls against a fused expression
+    if constexpr (std::is_floating_point_v<X>) {
+        std::vector<X> product1;
+        std::vector<X> product2;
+        std::vector<X> fusedResult;
+        const auto& c = data;
+        const double chained = sequential([&] {
+            vectorMult(data, c, product1);
+            vectorMult(c, data, product2);
+            vectorAdd(product1, product2);
+            return product1.back();
+        });
+        const double fused = sequential([&] {
+            evaluate(
+                fusedResult,
+                expression(data) * expression(c) +
+                    expression(c) * expression(data));
+            return fusedResult.back();
+        });
+        std::printf(
+            "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+            typeName,
+            "a*b+c*d",
+            chained,
+            fused,
+            chained / fused);
+    }
+    // the separate comparison loops against one compareWithTolerance pass
+    if constexpr (std::is_floating_point_v<X>) {
+        std::vector<X> shifted(data.begin(), data.end());
+        for (std::size_t ii = 0; ii < shifted.size(); ii += 97) {
+            shifted[ii] += static_cast<X>(0.01);
+        }
+        const std::span<const X> other(shifted);
+        const double separate = sequential([&] {
+            return static_cast<double>(countDiffs(view, other, X(0.001))) +
+                compareVec(view, other) + absMaxDiffLoc(view, other).first;
+        });
+        ToleranceOptions options;
+        options.absoluteTolerance = 0.001;
+        options.histogram = false;
+        const double combined = sequential([&] {
+            const auto report = compareWithTolerance(view, other, options);
+            return static_cast<double>(report.mismatches) + report.sumAbsDiff +
+                report.maxAbsDiff;
+        });
+        std::printf(
+            "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+            typeName,
+            "compare",
+            separate,
+            combined,
+            separate / combined);
+    }
+    // the values as the matrices and right hand sides of 4x4 systems stored
+    // as a structure of arrays, solved one at a time or as a batch
+    if constexpr (std::is_floating_point_v<X>) {
+        constexpr std::size_t order{4};
+        const std::size_t systems = data.size() / (order * order + order);
+        const std::span<const X> matrices =
+            view.first(order * order * systems);
+        const std::span<const X> rhs =
+            view.subspan(order * order * systems, order * systems);
+        std::vector<X> solutions(order * systems);
+        std::vector<X> conditions(systems);
+        const double single = sequential([&] {
+            X total{0};
+            for (std::size_t sys = 0; sys < systems; ++sys) {
+                std::array<std::array<X, order>, order> input;
+                std::array<X, order> vals;
+                for (std::size_t row = 0; row < order; ++row) {
+                    for (std::size_t col = 0; col < order; ++col) {
+                        input[row][col] =
+                            matrices[(row * order + col) * systems + sys];
+                    }
+                    vals[row] = rhs[row * systems + sys];
+                }
+                const auto result = solveNxN<order>(input, vals);
+                total += result.values[0] + result.condition;
+            }
+            return total;
+        });
+        const double batched = sequential([&] {
+            solveNxN<order, X>(
+                matrices, rhs, solutions, {}, std::span<X>(conditions));
+            return solutions[0] + conditions[0];
+        });
+        std::printf(
+            "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+            typeName,
+            "solve4x4",
+            single,
+            batched,
+            single / batched);
+    }
+    // a table of 1/16 of the values interpolated at every value, the scalar
+    // version searches and computes the slope for each point
+    if constexpr (std::is_floating_point_v<X>) {
+        const std::size_t points = (std::max)(data.size() / 16, std::size_t{2});
+        std::vector<X> tableTime(points);
+        std::vector<X> tableValue(points);
+        for (std::size_t ii = 0; ii < points; ++ii) {
+            const double fraction =
+                static_cast<double>(ii) / static_cast<double>(points - 1);
+            tableTime[ii] = static_cast<X>(-1.0 + 2.0 * fraction);
+            tableValue[ii] = data[ii];
+        }
+        std::vector<X> sortedTimes(data.begin(), data.end());
+        std::sort(sortedTimes.begin(), sortedTimes.end());
+        const Interpolator<X> table(tableTime, tableValue);
+        std::vector<X> result(data.size());
+        const auto scalarInterpolate = [&](const std::vector<X>& times) {
+            for (std::size_t ii = 0; ii < times.size(); ++ii) {
+                const auto upper = std::upper_bound(
+                    tableTime.begin() + 1, tableTime.end() - 1, times[ii]);
+                const auto seg =
+                    static_cast<std::size_t>(upper - tableTime.begin()) - 1;
+                result[ii] = tableValue[seg] +
+                    (tableValue[seg + 1] - tableValue[seg]) /
+                        (tableTime[seg + 1] - tableTime[seg]) *
+                        (times[ii] - tableTime[seg]);
+            }
+            return result.back();
+        };
+        const struct {
+            const char* name;
+            const std::vector<X>& times;
+        } cases[] = {{"interp", sortedTimes}, {"interpU", data}};
+        for (const auto& test : cases) {
+            const double scalar =
+                sequential([&] { return scalarInterpolate(test.times); });
+            const double engine = sequential([&] {
+                table.evaluate(test.times, std::span<X>(result));
+                return result.back();
+            });
+            std::printf(
+                "%-8s %-8s %10.3f %10.3f %8.1fx\n",
+                typeName,
+                test.name,
+                scalar,
+                engine,
+                scalar / engine);
+        }
+    }
+    std::printf("(checksum %g)\n", checksum);
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t count =
+        (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 16384U;
+    std::mt19937 gen(20261019);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> doubles(count);
+    std::vector<float> floats(count);
+    std::vector<std::int32_t> ints(count);
+    for (std::size_t ii = 0; ii < count; ++ii) {
+        doubles[ii] = dist(gen);
+        floats[ii] = static_cast<float>(doubles[ii]);
+        ints[ii] = static_cast<std::int32_t>(doubles[ii] * 1000.0);
+    }
+    std::printf(
+        "%zu elements, ns per element\n%-8s %-8s %10s %10s %9s\n",
+        count,
+        "type",
+        "kernel",
+        "scalar",
+        "vector",
+        "speedup");
+    compare("double", doubles);
+    compare("float", floats);
+    compare("int32", ints);
+    return 0;
+}
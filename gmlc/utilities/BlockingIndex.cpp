@@ -0,0 +1,347 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "BlockingIndex.h"
+
+#include "similarity.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmlc::utilities::similarity {
+namespace {
+    /** the length of the Metaphone codes used as keys*/
+    constexpr std::size_t metaphoneKeyLength{4};
+
+    constexpr unsigned char lowerByte(char testChar) noexcept
+    {
+        const auto byte = static_cast<unsigned char>(testChar);
+        return (byte >= 'A' && byte <= 'Z') ?
+            static_cast<unsigned char>(byte - 'A' + 'a') :
+            byte;
+    }
+
+    /** get the sorted distinct q-grams of a string padded with a space at
+    each end, each q-gram is packed into the bytes of an integer*/
+    std::vector<std::uint32_t> qgrams(std::string_view text, std::size_t size)
+    {
+        std::vector<std::uint32_t> grams;
+        const std::size_t paddedLength = text.size() + 2;
+        auto paddedByte = [text, paddedLength](std::size_t index) {
+            return (index == 0 || index + 1 == paddedLength) ?
+                static_cast<unsigned char>(' ') :
+                lowerByte(text[index - 1]);
+        };
+        const std::size_t count =
+            (paddedLength >= size) ? paddedLength - size + 1 : 1;
+        grams.reserve(count);
+        for (std::size_t start = 0; start < count; ++start) {
+            std::uint32_t gram{0};
+            for (std::size_t ii = start;
+                 ii < (std::min)(start + size, paddedLength);
+                 ++ii) {
+                gram = (gram << 8U) | paddedByte(ii);
+            }
+            grams.push_back(gram);
+        }
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        return grams;
+    }
+
+    /** split a name into the words made of ASCII letters*/
+    std::vector<std::string_view> words(std::string_view text)
+    {
+        std::vector<std::string_view> result;
+        std::size_t start{0};
+        const auto isLetter = [](char testChar) {
+            return (testChar >= 'a' && testChar <= 'z') ||
+                (testChar >= 'A' && testChar <= 'Z');
+        };
+        while (start < text.size()) {
+            while (start < text.size() && !isLetter(text[start])) {
+                ++start;
+            }
+            std::size_t end{start};
+            while (end < text.size() && isLetter(text[end])) {
+                ++end;
+            }
+            if (end > start) {
+                result.push_back(text.substr(start, end - start));
+            }
+            start = end;
+        }
+        return result;
+    }
+
+    /** get the distinct codes of the words of a name*/
+    template<typename Encoder>
+    std::vector<std::string> wordCodes(std::string_view text, Encoder encode)
+    {
+        std::vector<std::string> codes;
+        for (const auto word : words(text)) {
+            codes.push_back(encode(word));
+        }
+        std::sort(codes.begin(), codes.end());
+        codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+        return codes;
+    }
+
+    std::string metaphoneKey(std::string_view word)
+    {
+        return metaphone(word, metaphoneKeyLength);
+    }
+
+    /** count the values two sorted ranges have in common*/
+    std::size_t commonCount(
+        std::span<const std::uint32_t> values1,
+        std::span<const std::uint32_t> values2)
+    {
+        std::size_t common{0};
+        auto iter1 = values1.begin();
+        auto iter2 = values2.begin();
+        while (iter1 != values1.end() && iter2 != values2.end()) {
+            if (*iter1 < *iter2) {
+                ++iter1;
+            } else if (*iter2 < *iter1) {
+                ++iter2;
+            } else {
+                ++common;
+                ++iter1;
+                ++iter2;
+            }
+        }
+        return common;
+    }
+}  // namespace
+
+BlockingIndex::BlockingIndex(
+    std::span<const std::string_view> catalog,
+    const BlockingOptions& options) :
+    blockingOptions(options)
+{
+    if (options.qgramSize < 1 || options.qgramSize > 4) {
+        throw(std::invalid_argument("the q-gram size must be from 1 to 4"));
+    }
+    if (catalog.size() >= (std::numeric_limits<std::uint32_t>::max)()) {
+        throw(std::invalid_argument("the catalog is too large to index"));
+    }
+    entryLengths.reserve(catalog.size());
+    gramOffsets.reserve(catalog.size() + 1);
+    gramOffsets.push_back(0);
+    for (std::size_t ii = 0; ii < catalog.size(); ++ii) {
+        const auto entry = static_cast<std::uint32_t>(ii);
+        const std::string_view name = catalog[ii];
+        entryLengths.push_back(static_cast<std::uint32_t>((std::min)(
+            name.size(),
+            std::size_t{(std::numeric_limits<std::uint32_t>::max)()})));
+        maximumLength = (std::max)(maximumLength, entryLengths.back());
+        if (options.qgramKeys) {
+            const auto grams = qgrams(name, options.qgramSize);
+            entryGrams.insert(entryGrams.end(), grams.begin(), grams.end());
+            for (const auto gram : grams) {
+                gramPostings[gram].push_back(entry);
+            }
+        }
+        gramOffsets.push_back(entryGrams.size());
+        if (options.soundexKeys) {
+            for (const auto& code : wordCodes(name, soundex)) {
+                soundexPostings[code].push_back(entry);
+            }
+        }
+        if (options.metaphoneKeys) {
+            for (const auto& code : wordCodes(name, metaphoneKey)) {
+                metaphonePostings[code].push_back(entry);
+            }
+        }
+    }
+}
+
+/** memory reused between the queries of a search*/
+struct BlockingIndex::Workspace {
+    /// the entries seen for the current query are marked with visitMark,
+    /// the candidates already found with visitMark+1
+    std::vector<std::uint32_t> marks;
+    std::uint32_t visitMark{0};
+    /// flags of the entry lengths within the length tolerance of the query
+    std::vector<bool> lengthAllowed;
+    std::vector<std::uint32_t> possible;
+
+    void startQuery(const BlockingIndex& index, std::size_t queryLength)
+    {
+        if (marks.size() != index.size() ||
+            visitMark >= (std::numeric_limits<std::uint32_t>::max)() - 2) {
+            marks.assign(index.size(), 0);
+            visitMark = 0;
+        }
+        visitMark += 2;
+        lengthAllowed.resize(index.maximumLength + 1);
+        for (std::size_t length = 0; length <= index.maximumLength;
+             ++length) {
+            lengthAllowed[length] = index.similarLength(queryLength, length);
+        }
+    }
+    [[nodiscard]] bool allowed(const BlockingIndex& index, std::uint32_t entry)
+        const
+    {
+        return lengthAllowed[index.entryLengths[entry]];
+    }
+    /** add an entry to the candidates if it is not already there*/
+    void accept(std::uint32_t entry, std::vector<std::uint32_t>& found)
+    {
+        if (marks[entry] != visitMark + 1) {
+            marks[entry] = visitMark + 1;
+            found.push_back(entry);
+        }
+    }
+};
+
+bool BlockingIndex::similarLength(
+    std::size_t queryLength,
+    std::size_t entryLength) const
+{
+    const std::size_t difference = (entryLength > queryLength) ?
+        entryLength - queryLength :
+        queryLength - entryLength;
+    return static_cast<double>(difference) <=
+        blockingOptions.lengthTolerance *
+        static_cast<double>((std::max)(entryLength, queryLength));
+}
+
+void BlockingIndex::addQGramCandidates(
+    std::string_view query,
+    Workspace& workspace,
+    std::vector<std::uint32_t>& found) const
+{
+    if (blockingOptions.minimumQGramOverlap <= 0.0) {
+        for (std::size_t ii = 0; ii < entryLengths.size(); ++ii) {
+            const auto entry = static_cast<std::uint32_t>(ii);
+            if (workspace.allowed(*this, entry)) {
+                workspace.accept(entry, found);
+            }
+        }
+        return;
+    }
+    const auto grams = qgrams(query, blockingOptions.qgramSize);
+    const double overlap = (std::min)(blockingOptions.minimumQGramOverlap, 1.0);
+    const auto required = (std::max)(
+        std::size_t{1},
+        static_cast<std::size_t>(
+            std::ceil(overlap * static_cast<double>(grams.size()) - 1e-9)));
+    // an entry with required q-grams of the query must contain at least one
+    // of any grams.size()-required+1 of them, so only the shortest posting
+    // lists are read and the entries found are checked against the rest
+    const std::vector<std::uint32_t> missing;
+    std::vector<const std::vector<std::uint32_t>*> postings;
+    postings.reserve(grams.size());
+    for (const auto gram : grams) {
+        const auto posting = gramPostings.find(gram);
+        postings.push_back(
+            (posting != gramPostings.end()) ? &posting->second : &missing);
+    }
+    std::sort(
+        postings.begin(),
+        postings.end(),
+        [](const auto* posting1, const auto* posting2) {
+            return posting1->size() < posting2->size();
+        });
+    const std::size_t listCount = grams.size() - required + 1;
+    auto& possible = workspace.possible;
+    possible.clear();
+    for (std::size_t ii = 0; ii < listCount; ++ii) {
+        for (const auto entry : *postings[ii]) {
+            if (workspace.marks[entry] < workspace.visitMark &&
+                workspace.allowed(*this, entry)) {
+                workspace.marks[entry] = workspace.visitMark;
+                possible.push_back(entry);
+            }
+        }
+    }
+    for (const auto entry : possible) {
+        const std::span<const std::uint32_t> entryGramSpan(
+            entryGrams.data() + gramOffsets[entry],
+            gramOffsets[entry + 1] - gramOffsets[entry]);
+        if (commonCount(grams, entryGramSpan) >= required) {
+            workspace.accept(entry, found);
+        }
+    }
+}
+
+void BlockingIndex::addPhoneticCandidates(
+    const postingMap& postings,
+    const std::vector<std::string>& codes,
+    Workspace& workspace,
+    std::vector<std::uint32_t>& found) const
+{
+    for (const auto& code : codes) {
+        const auto posting = postings.find(code);
+        if (posting == postings.end() ||
+            posting->second.size() > blockingOptions.maximumBlockSize) {
+            continue;
+        }
+        for (const auto entry : posting->second) {
+            if (workspace.allowed(*this, entry)) {
+                workspace.accept(entry, found);
+            }
+        }
+    }
+}
+
+void BlockingIndex::findCandidates(
+    std::string_view query,
+    Workspace& workspace,
+    std::vector<std::uint32_t>& found) const
+{
+    found.clear();
+    workspace.startQuery(*this, query.size());
+    if (blockingOptions.qgramKeys) {
+        addQGramCandidates(query, workspace, found);
+    }
+    if (blockingOptions.soundexKeys) {
+        addPhoneticCandidates(
+            soundexPostings, wordCodes(query, soundex), workspace, found);
+    }
+    if (blockingOptions.metaphoneKeys) {
+        addPhoneticCandidates(
+            metaphonePostings,
+            wordCodes(query, metaphoneKey),
+            workspace,
+            found);
+    }
+    std::sort(found.begin(), found.end());
+}
+
+std::vector<std::size_t> BlockingIndex::candidates(std::string_view query) const
+{
+    Workspace workspace;
+    std::vector<std::uint32_t> found;
+    findCandidates(query, workspace, found);
+    return {found.begin(), found.end()};
+}
+
+std::vector<CandidatePair> BlockingIndex::candidatePairs(
+    std::span<const std::string_view> queries) const
+{
+    Workspace workspace;
+    std::vector<std::uint32_t> found;
+    std::vector<CandidatePair> pairs;
+    for (std::size_t ii = 0; ii < queries.size(); ++ii) {
+        findCandidates(queries[ii], workspace, found);
+        for (const auto entry : found) {
+            pairs.push_back({ii, entry});
+        }
+    }
+    return pairs;
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define an index of a catalog of names that selects the entries
+ *  worth comparing to a query with one of the similarity measures
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace similarity {
+    /** options selecting the keys used by a BlockingIndex
+    @details the defaults favor recall, raising minimumQGramOverlap or
+    lowering lengthTolerance and maximumBlockSize produce fewer candidates
+    and a faster comparison
+    */
+    struct BlockingOptions {
+        /// select entries containing enough of the q-grams of the query
+        bool qgramKeys{true};
+        /// the length of the q-grams indexed, from 1 to 4
+        std::size_t qgramSize{3};
+        /// the fraction of the distinct q-grams of a query a candidate must
+        /// contain, 0 makes every entry of a similar length a candidate
+        double minimumQGramOverlap{0.5};
+        /// select entries sharing the Soundex code of a word with the query
+        bool soundexKeys{true};
+        /// select entries sharing the Metaphone code of a word with the query
+        bool metaphoneKeys{true};
+        /// phonetic codes shared by more entries than this are ignored
+        std::size_t maximumBlockSize{1000};
+        /// the largest length difference of a candidate as a fraction of the
+        /// longer string, 1 accepts any length
+        double lengthTolerance{0.5};
+    };
+
+    /** a query and a catalog entry worth comparing*/
+    struct CandidatePair {
+        std::size_t queryIndex{0};
+        std::size_t catalogIndex{0};
+    };
+
+    /** an index of a catalog of names for finding the entries that may be
+    similar to a query without comparing the query to every entry
+    @details an entry is a candidate if its length is within the length
+    tolerance of the query and it contains enough of the q-grams of the query
+    or shares a phonetic code of a word with the query. Comparisons ignore the
+    case of ASCII letters. The index is immutable after construction so it can
+    be shared between threads
+    */
+    class BlockingIndex {
+      public:
+        /** index a catalog
+        @throw std::invalid_argument if the q-gram size is not 1 to 4 or the
+        catalog has more than 2^32-1 entries
+        */
+        explicit BlockingIndex(
+            std::span<const std::string_view> catalog,
+            const BlockingOptions& options = {});
+        /** get the catalog entries that may be similar to a query
+        @return the indices of the entries in ascending order*/
+        [[nodiscard]] std::vector<std::size_t>
+            candidates(std::string_view query) const;
+        /** get the pairs of queries and catalog entries that may be similar
+        @return the pairs ordered by query and then catalog index*/
+        [[nodiscard]] std::vector<CandidatePair>
+            candidatePairs(std::span<const std::string_view> queries) const;
+        /** get the number of entries in the catalog*/
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return entryLengths.size();
+        }
+        /** get the options the index was built with*/
+        [[nodiscard]] const BlockingOptions& options() const noexcept
+        {
+            return blockingOptions;
+        }
+
+      private:
+        using postingMap =
+            std::unordered_map<std::string, std::vector<std::uint32_t>>;
+
+        struct Workspace;
+
+        /** check if an entry length is within the tolerance of a query*/
+        [[nodiscard]] bool similarLength(
+            std::size_t queryLength,
+            std::size_t entryLength) const;
+        /** find the candidates of a query in ascending order*/
+        void findCandidates(
+            std::string_view query,
+            Workspace& workspace,
+            std::vector<std::uint32_t>& found) const;
+        /** add the entries containing enough q-grams of the query*/
+        void addQGramCandidates(
+            std::string_view query,
+            Workspace& workspace,
+            std::vector<std::uint32_t>& found) const;
+        /** add the entries sharing a phonetic code of a query word*/
+        void addPhoneticCandidates(
+            const postingMap& postings,
+            const std::vector<std::string>& codes,
+            Workspace& workspace,
+            std::vector<std::uint32_t>& found) const;
+
+        BlockingOptions blockingOptions;
+        std::vector<std::uint32_t> entryLengths;
+        std::uint32_t maximumLength{0};  //!< the length of the longest entry
+        /// the sorted distinct q-grams of entry ii are
+        /// entryGrams[gramOffsets[ii]] to entryGrams[gramOffsets[ii+1]]
+        std::vector<std::size_t> gramOffsets;
+        std::vector<std::uint32_t> entryGrams;
+        /// the entries containing each q-gram
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t>>
+            gramPostings;
+        postingMap soundexPostings;  //!< the entries with each Soundex code
+        postingMap metaphonePostings;  //!< the entries with each Metaphone code
+    };
+}  // namespace similarity
+}  // namespace gmlc::utilities
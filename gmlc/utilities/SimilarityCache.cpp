@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "SimilarityCache.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace gmlc::utilities::similarity {
+namespace {
+    constexpr std::uint64_t pairKey(std::uint32_t id1, std::uint32_t id2)
+    {
+        return (static_cast<std::uint64_t>(id1) << 32U) | id2;
+    }
+}  // namespace
+
+/** a stored result*/
+struct SimilarityCache::Slot {
+    std::uint64_t key{0};
+    double value{0.0};
+    /// set by every hit and cleared as the clock hand passes
+    mutable std::atomic<bool> referenced{false};
+};
+
+SimilarityCache::SimilarityCache(
+    std::size_t capacity,
+    similarity_metric metric,
+    case_sensitivity caseSensitivity) :
+    cacheCapacity(capacity),
+    scoreMetric(metric), sensitivity(caseSensitivity)
+{
+    // each result holds two strings which must fit in the 32 bit ids
+    if (capacity > (std::numeric_limits<std::uint32_t>::max)() / 2) {
+        throw(std::invalid_argument("the cache capacity is too large"));
+    }
+    if (!supportsSensitivity(metric, caseSensitivity)) {
+        throw(std::invalid_argument(
+            "the metric does not support case sensitive comparisons"));
+    }
+    slots = std::make_unique<Slot[]>(capacity);
+    entries.reserve(capacity);
+}
+
+SimilarityCache::~SimilarityCache() = default;
+
+const SimilarityCache::Slot*
+    SimilarityCache::findSlot(std::string_view str1, std::string_view str2)
+        const
+{
+    const auto interned1 = strings.find(str1);
+    if (interned1 == strings.end()) {
+        return nullptr;
+    }
+    const auto interned2 = strings.find(str2);
+    if (interned2 == strings.end()) {
+        return nullptr;
+    }
+    const auto entry =
+        entries.find(pairKey(interned1->second.id, interned2->second.id));
+    return (entry != entries.end()) ? &slots[entry->second] : nullptr;
+}
+
+double SimilarityCache::similarity(std::string_view str1, std::string_view str2)
+{
+    if (cacheCapacity > 0) {
+        const std::shared_lock<std::shared_mutex> readLock(lock);
+        const Slot* slot = findSlot(str1, str2);
+        if (slot != nullptr) {
+            slot->referenced.store(true, std::memory_order_relaxed);
+            hitCount.fetch_add(1, std::memory_order_relaxed);
+            return slot->value;
+        }
+    }
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    const double value = similarityScore(str1, str2, scoreMetric, sensitivity);
+    if (cacheCapacity > 0) {
+        const std::lock_guard<std::shared_mutex> writeLock(lock);
+        // another thread may have stored the pair while this one computed it
+        if (findSlot(str1, str2) == nullptr) {
+            store(str1, str2, value);
+        }
+    }
+    return value;
+}
+
+std::uint32_t SimilarityCache::intern(std::string_view text)
+{
+    auto interned = strings.find(text);
+    if (interned == strings.end()) {
+        std::uint32_t id{0};
+        if (freeIds.empty()) {
+            id = static_cast<std::uint32_t>(names.size());
+            names.push_back(nullptr);
+        } else {
+            id = freeIds.back();
+            freeIds.pop_back();
+        }
+        interned = strings.emplace(std::string(text), InternedString{id, 0})
+                       .first;
+        // references to the keys of an unordered_map survive rehashing
+        names[id] = &interned->first;
+    }
+    ++interned->second.uses;
+    return interned->second.id;
+}
+
+void SimilarityCache::release(std::uint32_t id)
+{
+    if (id >= names.size() || names[id] == nullptr) {
+        return;
+    }
+    const auto interned = strings.find(*names[id]);
+    if (interned == strings.end()) {
+        return;
+    }
+    if (--interned->second.uses == 0) {
+        strings.erase(interned);
+        names[id] = nullptr;
+        freeIds.push_back(id);
+    }
+}
+
+SimilarityCache::Slot& SimilarityCache::freeSlot()
+{
+    if (slotsUsed < cacheCapacity) {
+        return slots[slotsUsed++];
+    }
+    // a recently used result gets a second chance as the hand passes it
+    while (slots[clockHand].referenced.exchange(
+        false, std::memory_order_relaxed)) {
+        clockHand = (clockHand + 1) % cacheCapacity;
+    }
+    Slot& victim = slots[clockHand];
+    clockHand = (clockHand + 1) % cacheCapacity;
+    entries.erase(victim.key);
+    release(static_cast<std::uint32_t>(victim.key >> 32U));
+    release(static_cast<std::uint32_t>(victim.key & 0xFFFFFFFFU));
+    ++evictionCount;
+    return victim;
+}
+
+void SimilarityCache::store(
+    std::string_view str1,
+    std::string_view str2,
+    double value)
+{
+    // intern first so the eviction can not release the strings being added
+    const std::uint32_t id1 = intern(str1);
+    const std::uint32_t id2 = intern(str2);
+    Slot& slot = freeSlot();
+    slot.key = pairKey(id1, id2);
+    slot.value = value;
+    slot.referenced.store(false, std::memory_order_relaxed);
+    entries.emplace(slot.key, static_cast<std::size_t>(&slot - slots.get()));
+}
+
+SimilarityCacheStatistics SimilarityCache::statistics() const
+{
+    const std::shared_lock<std::shared_mutex> readLock(lock);
+    SimilarityCacheStatistics result;
+    result.hits = hitCount.load(std::memory_order_relaxed);
+    result.misses = missCount.load(std::memory_order_relaxed);
+    result.evictions = evictionCount;
+    result.size = entries.size();
+    return result;
+}
+
+void SimilarityCache::clear()
+{
+    const std::lock_guard<std::shared_mutex> writeLock(lock);
+    strings.clear();
+    names.clear();
+    freeIds.clear();
+    entries.clear();
+    slotsUsed = 0;
+    clockHand = 0;
+    hitCount.store(0, std::memory_order_relaxed);
+    missCount.store(0, std::memory_order_relaxed);
+    evictionCount = 0;
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define a thread safe cache of string similarity results
+ */
+#pragma once
+
+#include "SimilarityScorer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace similarity {
+    /** counters describing the use of a SimilarityCache*/
+    struct SimilarityCacheStatistics {
+        std::uint64_t hits{0};  //!< lookups answered from the cache
+        std::uint64_t misses{0};  //!< lookups that computed the similarity
+        std::uint64_t evictions{0};  //!< results removed to make room
+        std::size_t size{0};  //!< the number of results stored
+    };
+
+    /** memoize the similarity of string pairs compared repeatedly
+    @details the strings are interned so each stored result is keyed on a
+    pair of small integers, and results are evicted with the CLOCK
+    approximation of least recently used once the capacity is reached. A hit
+    takes a shared lock and sets a reference flag so concurrent lookups do not
+    block each other, a miss computes the similarity without holding the lock
+    and takes an exclusive lock only to store the result
+    */
+    class SimilarityCache {
+      public:
+        /** construct a cache
+        @param capacity the maximum number of results stored, 0 disables
+        caching
+        @param metric the similarity measure computed on a miss
+        @param sensitivity the case sensitivity of the comparisons
+        @throw std::invalid_argument if the capacity is too large to key the
+        interned strings with 32 bit integers or the metric does not support
+        the case sensitivity
+        */
+        explicit SimilarityCache(
+            std::size_t capacity,
+            similarity_metric metric = similarity_metric::jaro_winkler,
+            case_sensitivity sensitivity = case_sensitivity::insensitive);
+        ~SimilarityCache();
+        SimilarityCache(const SimilarityCache&) = delete;
+        SimilarityCache& operator=(const SimilarityCache&) = delete;
+
+        /** get the similarity of two strings, computing it on a miss
+        @details gives the same value as similarityScore(str1, str2, metric,
+        sensitivity)*/
+        double similarity(std::string_view str1, std::string_view str2);
+        /** get the current hit, miss and eviction counts*/
+        [[nodiscard]] SimilarityCacheStatistics statistics() const;
+        /** remove all stored results and reset the counters*/
+        void clear();
+
+        /** get the maximum number of results stored*/
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return cacheCapacity;
+        }
+        /** get the similarity measure in use*/
+        [[nodiscard]] similarity_metric metric() const noexcept
+        {
+            return scoreMetric;
+        }
+
+      private:
+        struct Slot;
+        /** hash std::string keys looked up with a std::string_view*/
+        struct StringHash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view text) const noexcept
+            {
+                return std::hash<std::string_view>{}(text);
+            }
+        };
+        struct InternedString {
+            std::uint32_t id{0};
+            std::uint32_t uses{0};  //!< the number of stored results using it
+        };
+        using internMap = std::unordered_map<
+            std::string,
+            InternedString,
+            StringHash,
+            std::equal_to<>>;
+
+        /** find a stored result, requires at least a shared lock*/
+        [[nodiscard]] const Slot*
+            findSlot(std::string_view str1, std::string_view str2) const;
+        /** get the id of a string adding it if needed, requires the
+        exclusive lock*/
+        std::uint32_t intern(std::string_view text);
+        /** release a use of an interned string, requires the exclusive lock,
+        an id that is not interned is ignored*/
+        void release(std::uint32_t id);
+        /** store a result, requires the exclusive lock*/
+        void store(std::string_view str1, std::string_view str2, double value);
+        /** pick the slot for a new result evicting one if the cache is full,
+        requires the exclusive lock*/
+        Slot& freeSlot();
+
+        std::size_t cacheCapacity;
+        similarity_metric scoreMetric;
+        case_sensitivity sensitivity;
+        mutable std::shared_mutex lock;
+        internMap strings;
+        /// the interned strings by id, ids of released strings are reused
+        std::vector<const std::string*> names;
+        std::vector<std::uint32_t> freeIds;
+        /// the slot of each stored result keyed on the two string ids
+        std::unordered_map<std::uint64_t, std::size_t> entries;
+        std::unique_ptr<Slot[]> slots;
+        std::size_t slotsUsed{0};
+        std::size_t clockHand{0};  //!< the next slot considered for eviction
+        std::atomic<std::uint64_t> hitCount{0};
+        std::atomic<std::uint64_t> missCount{0};
+        std::uint64_t evictionCount{0};
+    };
+}  // namespace similarity
+}  // namespace gmlc::utilities
@@ -0,0 +1,275 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "SimilarityScorer.h"
+
+#include "similarity.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmlc::utilities::similarity {
+namespace {
+    /** the largest possible Winkler prefix adjustment*/
+    constexpr double maxWinklerBoost{0.4};
+
+    std::size_t classIndex(char testChar) noexcept
+    {
+        return static_cast<std::size_t>(characterClass(testChar));
+    }
+
+    double editSimilarity(std::size_t distance, std::size_t longest) noexcept
+    {
+        return (longest == 0) ? 1.0 :
+                                1.0 -
+                static_cast<double>(distance) / static_cast<double>(longest);
+    }
+
+    /** throw if the metric can not compare with the case sensitivity*/
+    void checkSensitivity(
+        similarity_metric metric,
+        case_sensitivity sensitivity)
+    {
+        if (!supportsSensitivity(metric, sensitivity)) {
+            throw(std::invalid_argument(
+                "the metric does not support case sensitive comparisons"));
+        }
+    }
+}  // namespace
+
+double similarityScore(
+    std::string_view str1,
+    std::string_view str2,
+    similarity_metric metric,
+    case_sensitivity sensitivity)
+{
+    checkSensitivity(metric, sensitivity);
+    switch (metric) {
+        case similarity_metric::jaro_winkler:
+            return jaroWinkler(str1, str2, sensitivity);
+        case similarity_metric::edit_distance:
+            return editSimilarity(
+                editDistance(str1, str2, sensitivity),
+                (std::max)(str1.size(), str2.size()));
+        case similarity_metric::smith_waterman:
+            return smithWatermanSimilarity(str1, str2);
+        case similarity_metric::alignment:
+        default:
+            return alignmentSimilarity(str1, str2);
+    }
+}
+
+SimilarityScorer::SimilarityScorer(
+    std::string_view query,
+    similarity_metric metric,
+    case_sensitivity caseSensitivity) :
+    queryString(query),
+    scoreMetric(metric), sensitivity(caseSensitivity)
+{
+    checkSensitivity(scoreMetric, sensitivity);
+    if (sensitivity == case_sensitivity::insensitive) {
+        for (auto& queryChar : queryString) {
+            if (queryChar >= 'A' && queryChar <= 'Z') {
+                queryChar = static_cast<char>(queryChar - 'A' + 'a');
+            }
+        }
+    }
+    for (const char queryChar : queryString) {
+        ++queryHistogram[classIndex(queryChar)];
+    }
+    switch (scoreMetric) {
+        case similarity_metric::jaro_winkler:
+            jaroPattern.emplace(queryString, sensitivity);
+            break;
+        case similarity_metric::edit_distance:
+            editPattern.emplace(queryString, sensitivity);
+            break;
+        case similarity_metric::smith_waterman:
+            alignmentProfile.emplace(queryString);
+            break;
+        default:
+            break;
+    }
+}
+
+std::size_t SimilarityScorer::possibleMatches(std::string_view candidate) const
+{
+    histogram candidateHistogram{};
+    for (const char candidateChar : candidate) {
+        ++candidateHistogram[classIndex(candidateChar)];
+    }
+    std::size_t matches{0};
+    for (std::size_t ii = 0; ii < candidateHistogram.size(); ++ii) {
+        matches += (std::min)(candidateHistogram[ii], queryHistogram[ii]);
+    }
+    return matches;
+}
+
+double SimilarityScorer::boundFromMatches(
+    std::size_t matches,
+    std::size_t candidateLength) const noexcept
+{
+    const std::size_t queryLength = queryString.size();
+    if (queryLength == 0 || candidateLength == 0) {
+        return (queryLength == candidateLength) ? 1.0 : 0.0;
+    }
+    const auto common = static_cast<double>(matches);
+    const auto length1 = static_cast<double>(queryLength);
+    const auto length2 = static_cast<double>(candidateLength);
+    switch (scoreMetric) {
+        case similarity_metric::jaro_winkler: {
+            if (matches == 0) {
+                return 0.0;
+            }
+            // at best every possible match is found with no transpositions
+            const double jaro =
+                (common / length1 + common / length2 + 1.0) / 3.0;
+            return jaro + maxWinklerBoost * (1.0 - jaro);
+        }
+        case similarity_metric::edit_distance:
+            // characters without a possible match must be edited
+            return common / (std::max)(length1, length2);
+        case similarity_metric::smith_waterman:
+            // only matching characters add to the local alignment score
+            return common / (std::min)(length1, length2);
+        case similarity_metric::alignment:
+        default:
+            return 1.0;
+    }
+}
+
+double SimilarityScorer::scoreBound(std::string_view candidate) const
+{
+    return boundFromMatches(possibleMatches(candidate), candidate.size());
+}
+
+std::optional<double> SimilarityScorer::scoreAbove(
+    std::string_view candidate,
+    double threshold) const
+{
+    // the length bound is free, the histogram bound is linear in the length
+    const std::size_t lengthMatches =
+        (std::min)(queryString.size(), candidate.size());
+    if (boundFromMatches(lengthMatches, candidate.size()) <= threshold ||
+        scoreBound(candidate) <= threshold) {
+        return std::nullopt;
+    }
+    double result{0.0};
+    switch (scoreMetric) {
+        case similarity_metric::jaro_winkler:
+            result = jaroPattern->similarity(candidate);
+            break;
+        case similarity_metric::edit_distance: {
+            const std::size_t longest =
+                (std::max)(queryString.size(), candidate.size());
+            // the distance must be below (1-threshold)*longest to score higher
+            const double allowed =
+                (1.0 - threshold) * static_cast<double>(longest);
+            const std::size_t maxDistance =
+                (allowed >= static_cast<double>(longest)) ?
+                longest :
+                static_cast<std::size_t>(std::floor(allowed));
+            const std::size_t distance =
+                editPattern->distance(candidate, maxDistance);
+            if (distance > maxDistance) {
+                return std::nullopt;
+            }
+            result = editSimilarity(distance, longest);
+        } break;
+        case similarity_metric::smith_waterman:
+            result = alignmentProfile->similarity(candidate);
+            break;
+        case similarity_metric::alignment:
+            // returns 0 once the score can not reach the threshold
+            result =
+                boundedAlignmentSimilarity(queryString, candidate, threshold);
+            break;
+    }
+    if (result <= threshold) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+double SimilarityScorer::score(std::string_view candidate) const
+{
+    switch (scoreMetric) {
+        case similarity_metric::jaro_winkler:
+            return jaroPattern->similarity(candidate);
+        case similarity_metric::edit_distance:
+            return editSimilarity(
+                editPattern->distance(candidate),
+                (std::max)(queryString.size(), candidate.size()));
+        case similarity_metric::smith_waterman:
+            return alignmentProfile->similarity(candidate);
+        case similarity_metric::alignment:
+        default:
+            return alignmentSimilarity(queryString, candidate);
+    }
+}
+
+void SimilarityScorer::score(
+    std::span<const std::string_view> candidates,
+    std::span<double> scores) const
+{
+    if (candidates.size() != scores.size()) {
+        throw(std::invalid_argument(
+            "scores must be the same size as the candidates"));
+    }
+    for (std::size_t ii = 0; ii < candidates.size(); ++ii) {
+        scores[ii] = score(candidates[ii]);
+    }
+}
+
+std::vector<double>
+    SimilarityScorer::score(std::span<const std::string_view> candidates) const
+{
+    std::vector<double> scores(candidates.size());
+    score(candidates, scores);
+    return scores;
+}
+
+std::vector<ScoredCandidate> SimilarityScorer::topK(
+    std::span<const std::string_view> candidates,
+    std::size_t count,
+    double minimumScore) const
+{
+    std::vector<ScoredCandidate> best;
+    if (count == 0) {
+        return best;
+    }
+    best.reserve((std::min)(count, candidates.size()));
+    // scores equal to minimumScore are accepted
+    const double minimumThreshold =
+        std::nextafter(minimumScore, -std::numeric_limits<double>::infinity());
+    // the heap front is the worst of the current best candidates
+    for (std::size_t ii = 0; ii < candidates.size(); ++ii) {
+        const double threshold = (best.size() < count) ?
+            minimumThreshold :
+            (std::max)(minimumThreshold, best.front().score);
+        const auto result = scoreAbove(candidates[ii], threshold);
+        if (!result) {
+            continue;
+        }
+        if (best.size() == count) {
+            std::pop_heap(best.begin(), best.end(), betterCandidate);
+            best.pop_back();
+        }
+        best.push_back({ii, *result});
+        std::push_heap(best.begin(), best.end(), betterCandidate);
+    }
+    std::sort_heap(best.begin(), best.end(), betterCandidate);
+    return best;
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,163 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define a scorer comparing one query string against many candidates
+ */
+#pragma once
+
+#include "similarity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace similarity {
+    /** the similarity measures available in a SimilarityScorer*/
+    enum class similarity_metric : std::uint8_t {
+        jaro_winkler,  //!< jaroWinkler
+        edit_distance,  //!< 1 - editDistance / length of the longer string
+        smith_waterman,  //!< smithWatermanSimilarity
+        alignment  //!< alignmentSimilarity
+    };
+
+    /** a candidate and its similarity to the query*/
+    struct ScoredCandidate {
+        std::size_t index{0};  //!< the index of the candidate
+        double score{0.0};  //!< the similarity score
+    };
+
+    /** order candidates from most to least similar with ties ordered by
+    ascending index*/
+    constexpr bool betterCandidate(
+        const ScoredCandidate& candidate1,
+        const ScoredCandidate& candidate2) noexcept
+    {
+        return (candidate1.score > candidate2.score) ||
+            (candidate1.score == candidate2.score &&
+             candidate1.index < candidate2.index);
+    }
+
+    /** check if a metric can compare strings with a case sensitivity
+    @details the smith_waterman and alignment metrics compare character
+    classes which ignore case, so they only support case insensitive scores*/
+    constexpr bool supportsSensitivity(
+        similarity_metric metric,
+        case_sensitivity sensitivity) noexcept
+    {
+        return sensitivity == case_sensitivity::insensitive ||
+            metric == similarity_metric::jaro_winkler ||
+            metric == similarity_metric::edit_distance;
+    }
+
+    /** compute the similarity of two strings
+    @details gives the same value as a SimilarityScorer of str1 scoring str2
+    @return a value between 0 (no similarity) and 1 (identical)
+    @throw std::invalid_argument if the metric does not support the case
+    sensitivity
+    */
+    double similarityScore(
+        std::string_view str1,
+        std::string_view str2,
+        similarity_metric metric = similarity_metric::jaro_winkler,
+        case_sensitivity sensitivity = case_sensitivity::insensitive);
+
+    /** score one query string against many candidate strings
+    @details the query is preprocessed once on construction (the case folded
+    query, a character class histogram, and the bit masks or the alignment
+    query profile depending on the metric). All scores are similarities
+    between 0 and 1 where higher is more similar. The scorer is immutable
+    after construction so it can be shared between threads
+    */
+    class SimilarityScorer {
+      public:
+        /** construct a scorer for a query
+        @throw std::invalid_argument if the metric does not support the case
+        sensitivity, see supportsSensitivity
+        */
+        explicit SimilarityScorer(
+            std::string_view query,
+            similarity_metric metric = similarity_metric::jaro_winkler,
+            case_sensitivity sensitivity = case_sensitivity::insensitive);
+
+        /** compute the similarity of the query to a single candidate*/
+        [[nodiscard]] double score(std::string_view candidate) const;
+        /** compute the similarity of the query to each candidate
+        @param candidates the strings to score
+        @param[out] scores the scores, must be the same size as candidates
+        @throw std::invalid_argument if the sizes do not match
+        */
+        void score(
+            std::span<const std::string_view> candidates,
+            std::span<double> scores) const;
+        /** compute the similarity of the query to each candidate*/
+        [[nodiscard]] std::vector<double>
+            score(std::span<const std::string_view> candidates) const;
+        /** find the candidates most similar to the query
+        @details candidates that can not reach the current k-th best score are
+        rejected from cheap length and character histogram bounds before they
+        are scored, ties are resolved in favor of the lower index
+        @param candidates the strings to search
+        @param count the maximum number of results
+        @param minimumScore only candidates with a score at least this large
+        are returned
+        @return the best candidates ordered from most to least similar
+        */
+        [[nodiscard]] std::vector<ScoredCandidate> topK(
+            std::span<const std::string_view> candidates,
+            std::size_t count,
+            double minimumScore = 0.0) const;
+        /** get an upper bound on the score of a candidate
+        @details computed from the lengths and character class histograms in
+        time proportional to the candidate length
+        */
+        [[nodiscard]] double scoreBound(std::string_view candidate) const;
+
+        /** get the query string*/
+        [[nodiscard]] const std::string& query() const noexcept
+        {
+            return queryString;
+        }
+        /** get the similarity measure in use*/
+        [[nodiscard]] similarity_metric metric() const noexcept
+        {
+            return scoreMetric;
+        }
+
+      private:
+        using histogram =
+            std::array<std::uint32_t, static_cast<std::size_t>(
+                                          characterClassCount)>;
+        /** score a candidate if it can score higher than threshold
+        @return the score or std::nullopt if it can not exceed threshold*/
+        [[nodiscard]] std::optional<double>
+            scoreAbove(std::string_view candidate, double threshold) const;
+        /** get an upper bound on the score of a candidate with at most
+        matches characters matching the query*/
+        [[nodiscard]] double boundFromMatches(
+            std::size_t matches,
+            std::size_t candidateLength) const noexcept;
+        /** count the characters of the candidate that could match the query*/
+        [[nodiscard]] std::size_t
+            possibleMatches(std::string_view candidate) const;
+
+        std::string queryString;  //!< the query with case folded if needed
+        similarity_metric scoreMetric;
+        case_sensitivity sensitivity;
+        histogram queryHistogram{};  //!< character class counts of the query
+        std::optional<JaroWinklerPattern> jaroPattern;
+        std::optional<EditDistancePattern> editPattern;
+        std::optional<SmithWatermanProfile> alignmentProfile;
+    };
+}  // namespace similarity
+}  // namespace gmlc::utilities
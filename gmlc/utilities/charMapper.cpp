@@ -13,73 +13,6 @@
 #include "charMapper.h"
 
 namespace gmlc::utilities {
-CharMapper<bool> numericMapper() noexcept
-{
-    CharMapper<bool> mapper(false);
-    mapper.addKey('0', true);
-    mapper.addKey('1', true);
-    mapper.addKey('2', true);
-    mapper.addKey('3', true);
-    mapper.addKey('4', true);
-    mapper.addKey('5', true);
-    mapper.addKey('6', true);
-    mapper.addKey('7', true);
-    mapper.addKey('8', true);
-    mapper.addKey('9', true);
-    mapper.addKey('+', true);
-    mapper.addKey('-', true);
-    mapper.addKey(' ', true);
-    mapper.addKey('e', true);
-    mapper.addKey('E', true);
-    mapper.addKey('.', true);
-    return mapper;
-}
-
-CharMapper<bool> numericStartMapper() noexcept
-{
-    CharMapper<bool> mapper(false);
-    mapper.addKey('0', true);
-    mapper.addKey('1', true);
-    mapper.addKey('2', true);
-    mapper.addKey('3', true);
-    mapper.addKey('4', true);
-    mapper.addKey('5', true);
-    mapper.addKey('6', true);
-    mapper.addKey('7', true);
-    mapper.addKey('8', true);
-    mapper.addKey('9', true);
-    mapper.addKey('+', true);
-    mapper.addKey('-', true);
-    mapper.addKey(' ', true);
-    mapper.addKey('\t', true);
-    mapper.addKey('.', true);
-    mapper.addKey('\n', true);
-    mapper.addKey('\r', true);
-    mapper.addKey('\0', true);
-    return mapper;
-}
-
-CharMapper<bool> numericEndMapper() noexcept
-{
-    CharMapper<bool> mapper(false);
-    mapper.addKey('0', true);
-    mapper.addKey('1', true);
-    mapper.addKey('2', true);
-    mapper.addKey('3', true);
-    mapper.addKey('4', true);
-    mapper.addKey('5', true);
-    mapper.addKey('6', true);
-    mapper.addKey('7', true);
-    mapper.addKey('8', true);
-    mapper.addKey('9', true);
-    mapper.addKey(' ', true);
-    mapper.addKey('\t', true);
-    mapper.addKey('\n', true);
-    mapper.addKey('\r', true);
-    mapper.addKey('\0', true);
-    return mapper;
-}
-
 CharMapper<unsigned char> base64Mapper() noexcept
 {
     CharMapper<unsigned char> b64(0xFF);
@@ -12,26 +12,34 @@
 #pragma once
 
 #include <array>
+#include <string_view>
+
 namespace gmlc::utilities {
 /** small helper class to map characters to values*/
 template<typename V>
 class CharMapper {
   private:
-    std::array<V, 256> key;  //!< the character map
+    std::array<V, 256> key{};  //!< the character map
   public:
     /** default constructor*/
-    explicit CharMapper(V defVal = V{0}) noexcept { key.fill(defVal); }
+    constexpr explicit CharMapper(V defVal = V{0}) noexcept
+    {
+        key.fill(defVal);
+    }
     /** update the value returned from a key query
 @details this is purposely distinct from the [] operator to make it an error
 to try to assign something that way
 */
-    void addKey(unsigned char keyChar, V val) noexcept { key[keyChar] = val; }
+    constexpr void addKey(unsigned char keyChar, V val) noexcept
+    {
+        key[keyChar] = val;
+    }
     /** get the value assigned to a character
      * @param keyChar the character to test or convert
      * @return the resulting value,  0 if nothing in particular is specified
      * in a given map
      */
-    [[nodiscard]] V at(unsigned char keyChar) const noexcept
+    [[nodiscard]] constexpr V at(unsigned char keyChar) const noexcept
     {
         return key[keyChar];
     }
@@ -40,17 +48,43 @@ to try to assign something that way
      * @return the resulting value,  0 if nothing in particular is specified
      * in a given map
      */
-    V operator[](unsigned char keyChar) const noexcept { return key[keyChar]; }
+    constexpr V operator[](unsigned char keyChar) const noexcept
+    {
+        return key[keyChar];
+    }
 };
 /** map that translates all characters that could be in numbers to true all
  * others to false*/
-CharMapper<bool> numericMapper() noexcept;
+constexpr CharMapper<bool> numericMapper() noexcept
+{
+    CharMapper<bool> mapper(false);
+    for (const char numChar : std::string_view("0123456789+- eE.")) {
+        mapper.addKey(numChar, true);
+    }
+    return mapper;
+}
 /** map that translates all characters that could start a number to true, all
  * others to false*/
-CharMapper<bool> numericStartMapper() noexcept;
+constexpr CharMapper<bool> numericStartMapper() noexcept
+{
+    CharMapper<bool> mapper(false);
+    for (const char numChar : std::string_view("0123456789+- \t.\n\r")) {
+        mapper.addKey(numChar, true);
+    }
+    mapper.addKey('\0', true);
+    return mapper;
+}
 /** map that translates all characters that could end a number to true, all
  * others to false*/
-CharMapper<bool> numericEndMapper() noexcept;
+constexpr CharMapper<bool> numericEndMapper() noexcept
+{
+    CharMapper<bool> mapper(false);
+    for (const char numChar : std::string_view("0123456789 \t\n\r")) {
+        mapper.addKey(numChar, true);
+    }
+    mapper.addKey('\0', true);
+    return mapper;
+}
 /** map that translates all base 64 characters to the appropriate numerical
  * value*/
 CharMapper<unsigned char> base64Mapper() noexcept;
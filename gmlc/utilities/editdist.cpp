@@ -1,68 +1,241 @@
 /*
-Copyright (c) 2017-2020,
+Copyright (c) 2017-2026,
 Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
 for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
 All rights reserved. SPDX-License-Identifier: BSD-3-Clause
 */
-#include "namecmp.h"
+#include "similarity.h"
 
-#include <cctype>
-#include <cstdarg>
-#include <cstdio>
-#include <cstring>
-namespace gmlc {
-namespace utilities {
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
 
-    int edit_distace(char* n1, char* n2)
+/* the edit distance uses the bit-parallel algorithm of Myers (1999) as
+formulated by Hyyrö (2001), the columns of the dynamic programming table are
+encoded as bit vectors of vertical differences so each character of the text
+updates 64 cells of a column at once*/
+
+namespace gmlc::utilities::similarity {
+namespace {
+    constexpr std::size_t wordBits{64};
+    constexpr std::size_t alphabetSize{detail::matchTableBlockSize};
+
+    constexpr std::size_t charIndex(char testChar) noexcept
     {
-        int result = 888;
-        int edit[26][26];
-        int ii = 0, jj = 0;
-        int len_s1 = 0, len_s2 = 0;
-        char s1_loc[25];
-        char s2_loc[25];
+        return static_cast<unsigned char>(testChar);
+    }
 
-        /*do a null check*/
-        /*this test is not relevant in C*/
+    /** the edit distance is larger than maxDistance if the distance in the
+    last row can not decrease enough over the remaining text*/
+    constexpr bool exceedsBound(
+        std::size_t score,
+        std::size_t remaining,
+        std::size_t maxDistance) noexcept
+    {
+        return score > maxDistance + remaining;
+    }
 
-        /*first check if we have an exact match*/
-        if (strIeq(n1, n2)) {
-            result = 0;
-            return result;
-        }
-        len_s1 = static_cast<int>(strlen(n1));
-        len_s2 = static_cast<int>(strlen(n2));
-        /*more null checks if one string is a null*/
-        /*also not relevant to C*/
-        for (ii = 0; ii < (std::min)(25, len_s1); ii++) {
-            s1_loc[ii] = static_cast<char>(toupper(n1[ii]));
-        }
-        len_s1 = ii;
-        for (ii = 0; ii < (std::min)(25, len_s2); ii++) {
-            s2_loc[ii] = static_cast<char>(toupper(n2[ii]));
-        }
-        len_s2 = ii;
-        memset(edit, 0, sizeof(int) * 26 * 26);
-        for (ii = 0; ii < len_s1; ii++) {
-            edit[ii][0] = ii;
-        }
-        for (ii = 0; ii < len_s2; ii++) {
-            edit[0][ii] = ii;
+    /** edit distance for a pattern of at most 64 characters*/
+    std::size_t singleWordDistance(
+        const std::uint64_t* matchTable,
+        std::size_t patternLength,
+        std::string_view text,
+        std::size_t maxDistance)
+    {
+        const std::uint64_t lastBit = std::uint64_t{1} << (patternLength - 1);
+        std::uint64_t positive{~std::uint64_t{0}};
+        std::uint64_t negative{0};
+        std::size_t score{patternLength};
+        std::size_t remaining{text.size()};
+        for (const char textChar : text) {
+            const std::uint64_t match = matchTable[charIndex(textChar)];
+            const std::uint64_t vertical = match | negative;
+            const std::uint64_t horizontal =
+                (((match & positive) + positive) ^ positive) | match;
+            std::uint64_t horizontalPositive =
+                negative | ~(horizontal | positive);
+            std::uint64_t horizontalNegative = positive & horizontal;
+            if ((horizontalPositive & lastBit) != 0) {
+                ++score;
+            } else if ((horizontalNegative & lastBit) != 0) {
+                --score;
+            }
+            --remaining;
+            if (exceedsBound(score, remaining, maxDistance)) {
+                return maxDistance + 1;
+            }
+            horizontalPositive = (horizontalPositive << 1U) | 1U;
+            horizontalNegative <<= 1U;
+            positive = horizontalNegative | ~(vertical | horizontalPositive);
+            negative = horizontalPositive & vertical;
         }
-        for (ii = 1; ii <= len_s1; ii++) {
-            for (jj = 1; jj <= len_s2; jj++) {
-                if (s1_loc[ii - 1] == s2_loc[jj - 1]) {
-                    edit[ii][jj] = (std::min)((std::min)(edit[ii - 1][jj] + 1,
-                                                         edit[ii][jj - 1] + 1),
-                                              edit[ii - 1][jj - 1]);
-                } else {
-                    edit[ii][jj] = (std::min)((std::min)(edit[ii - 1][jj] + 1,
-                                                         edit[ii][jj - 1] + 1),
-                                              edit[ii - 1][jj - 1] + 1);
+        return score;
+    }
+
+    /** edit distance for a pattern split into blocks of 64 characters*/
+    std::size_t blockedDistance(
+        const std::uint64_t* matchTable,
+        std::size_t patternLength,
+        std::string_view text,
+        std::size_t maxDistance)
+    {
+        const std::size_t blocks = (patternLength + wordBits - 1) / wordBits;
+        const std::uint64_t highBit = std::uint64_t{1} << (wordBits - 1);
+        const std::uint64_t lastBit = std::uint64_t{1}
+            << ((patternLength - 1) % wordBits);
+        std::vector<std::uint64_t> positive(blocks, ~std::uint64_t{0});
+        std::vector<std::uint64_t> negative(blocks, 0);
+        std::size_t score{patternLength};
+        std::size_t remaining{text.size()};
+        for (const char textChar : text) {
+            // the top row of the table increases by one in each column
+            int carry{1};
+            for (std::size_t block = 0; block < blocks; ++block) {
+                std::uint64_t match =
+                    matchTable[block * alphabetSize + charIndex(textChar)];
+                const std::uint64_t vertical = match | negative[block];
+                if (carry < 0) {
+                    match |= 1U;
+                }
+                const std::uint64_t horizontal =
+                    (((match & positive[block]) + positive[block]) ^
+                     positive[block]) |
+                    match;
+                std::uint64_t horizontalPositive =
+                    negative[block] | ~(horizontal | positive[block]);
+                std::uint64_t horizontalNegative = positive[block] & horizontal;
+                const std::uint64_t outBit =
+                    (block + 1 == blocks) ? lastBit : highBit;
+                const int carryIn = carry;
+                carry = ((horizontalPositive & outBit) != 0) ?
+                    1 :
+                    (((horizontalNegative & outBit) != 0) ? -1 : 0);
+                horizontalPositive <<= 1U;
+                horizontalNegative <<= 1U;
+                if (carryIn < 0) {
+                    horizontalNegative |= 1U;
+                } else if (carryIn > 0) {
+                    horizontalPositive |= 1U;
                 }
+                positive[block] =
+                    horizontalNegative | ~(vertical | horizontalPositive);
+                negative[block] = horizontalPositive & vertical;
+            }
+            if (carry > 0) {
+                ++score;
+            } else if (carry < 0) {
+                --score;
+            }
+            --remaining;
+            if (exceedsBound(score, remaining, maxDistance)) {
+                return maxDistance + 1;
             }
         }
-        return (edit[len_s1][len_s2]);
+        return score;
     }
-}  // namespace utilities
-}  // namespace gmlc
+}  // namespace
+
+void detail::buildMatchTable(
+    std::string_view pattern,
+    case_sensitivity sensitivity,
+    std::uint64_t* table)
+{
+    for (std::size_t ii = 0; ii < pattern.size(); ++ii) {
+        const std::uint64_t bit = std::uint64_t{1} << (ii % wordBits);
+        std::uint64_t* block = table + (ii / wordBits) * alphabetSize;
+        block[charIndex(pattern[ii])] |= bit;
+        if (sensitivity == case_sensitivity::insensitive) {
+            const char testChar = pattern[ii];
+            if (testChar >= 'a' && testChar <= 'z') {
+                block[charIndex(static_cast<char>(testChar - 'a' + 'A'))] |=
+                    bit;
+            } else if (testChar >= 'A' && testChar <= 'Z') {
+                block[charIndex(static_cast<char>(testChar - 'A' + 'a'))] |=
+                    bit;
+            }
+        }
+    }
+}
+
+bool strIeq(std::string_view str1, std::string_view str2) noexcept
+{
+    if (str1.size() != str2.size()) {
+        return false;
+    }
+    return std::equal(str1.begin(), str1.end(), str2.begin(), charIeq);
+}
+
+std::size_t boundedEditDistance(
+    std::string_view str1,
+    std::string_view str2,
+    std::size_t maxDistance,
+    case_sensitivity sensitivity)
+{
+    // the pattern is the shorter string so the fewest blocks are needed
+    if (str1.size() > str2.size()) {
+        std::swap(str1, str2);
+    }
+    if (str2.size() - str1.size() > maxDistance) {
+        return maxDistance + 1;
+    }
+    if (str1.empty()) {
+        return str2.size();
+    }
+    if (str1.size() <= wordBits) {
+        std::array<std::uint64_t, alphabetSize> matchTable{};
+        detail::buildMatchTable(str1, sensitivity, matchTable.data());
+        return singleWordDistance(
+            matchTable.data(), str1.size(), str2, maxDistance);
+    }
+    return EditDistancePattern(str1, sensitivity).distance(str2, maxDistance);
+}
+
+std::size_t editDistance(
+    std::string_view str1,
+    std::string_view str2,
+    case_sensitivity sensitivity)
+{
+    return boundedEditDistance(
+        str1, str2, (std::max)(str1.size(), str2.size()), sensitivity);
+}
+
+EditDistancePattern::EditDistancePattern(
+    std::string_view pattern,
+    case_sensitivity sensitivity) :
+    matchTable(
+        ((pattern.size() + wordBits - 1) / wordBits) * alphabetSize,
+        0),
+    patternLength(pattern.size())
+{
+    detail::buildMatchTable(pattern, sensitivity, matchTable.data());
+}
+
+std::size_t EditDistancePattern::distance(
+    std::string_view text,
+    std::size_t maxDistance) const
+{
+    const std::size_t lengthDifference = (text.size() > patternLength) ?
+        text.size() - patternLength :
+        patternLength - text.size();
+    if (lengthDifference > maxDistance) {
+        return maxDistance + 1;
+    }
+    if (patternLength == 0) {
+        return text.size();
+    }
+    if (patternLength <= wordBits) {
+        return singleWordDistance(
+            matchTable.data(), patternLength, text, maxDistance);
+    }
+    return blockedDistance(matchTable.data(), patternLength, text, maxDistance);
+}
+
+std::size_t EditDistancePattern::distance(std::string_view text) const
+{
+    return distance(text, (std::max)(text.size(), patternLength));
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "fuzzySearch.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace gmlc::utilities::similarity {
+namespace {
+    std::vector<ScoredCandidate> searchShard(
+        const SimilarityScorer& scorer,
+        std::span<const std::string_view> catalog,
+        std::size_t start,
+        std::size_t length,
+        std::size_t count,
+        double minimumScore)
+    {
+        auto best =
+            scorer.topK(catalog.subspan(start, length), count, minimumScore);
+        for (auto& result : best) {
+            result.index += start;
+        }
+        return best;
+    }
+}  // namespace
+
+std::vector<ScoredCandidate> fuzzySearch(
+    const SimilarityScorer& scorer,
+    std::span<const std::string_view> catalog,
+    std::size_t count,
+    const FuzzySearchOptions& options)
+{
+    if (count == 0 || catalog.empty()) {
+        return {};
+    }
+    std::size_t threads = (options.threads == 0) ?
+        std::thread::hardware_concurrency() :
+        options.threads;
+    const std::size_t shardSize = (std::max)(options.minimumShardSize, count);
+    threads = std::clamp<std::size_t>(
+        threads, 1, (catalog.size() + shardSize - 1) / shardSize);
+    if (threads == 1) {
+        return scorer.topK(catalog, count, options.minimumScore);
+    }
+    const std::size_t baseLength = catalog.size() / threads;
+    const std::size_t extra = catalog.size() % threads;
+    const std::size_t firstLength = baseLength + ((extra > 0) ? 1U : 0U);
+    std::vector<std::future<std::vector<ScoredCandidate>>> shards;
+    shards.reserve(threads - 1);
+    std::size_t start{firstLength};
+    for (std::size_t shard = 1; shard < threads; ++shard) {
+        const std::size_t length = baseLength + ((shard < extra) ? 1U : 0U);
+        shards.push_back(std::async(
+            std::launch::async,
+            searchShard,
+            std::cref(scorer),
+            catalog,
+            start,
+            length,
+            count,
+            options.minimumScore));
+        start += length;
+    }
+    // the calling thread searches the first shard
+    auto best = searchShard(
+        scorer, catalog, 0, firstLength, count, options.minimumScore);
+    // each shard result is already ordered so merge them and keep the best
+    for (auto& shard : shards) {
+        auto shardBest = shard.get();
+        const auto merged = static_cast<std::ptrdiff_t>(best.size());
+        best.insert(best.end(), shardBest.begin(), shardBest.end());
+        std::inplace_merge(
+            best.begin(), best.begin() + merged, best.end(), betterCandidate);
+        best.resize((std::min)(count, best.size()));
+    }
+    return best;
+}
+
+std::vector<ScoredCandidate> fuzzySearch(
+    std::string_view query,
+    std::span<const std::string_view> catalog,
+    std::size_t count,
+    similarity_metric metric,
+    const FuzzySearchOptions& options)
+{
+    const SimilarityScorer scorer(query, metric);
+    return fuzzySearch(scorer, catalog, count, options);
+}
+}  // namespace gmlc::utilities::similarity
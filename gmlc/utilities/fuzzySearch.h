@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define a multithreaded search for the strings in a catalog most
+ *  similar to a query
+ */
+#pragma once
+
+#include "SimilarityScorer.h"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace similarity {
+    /** options controlling a fuzzy search*/
+    struct FuzzySearchOptions {
+        /// only candidates with a score at least this large are returned
+        double minimumScore{0.0};
+        /// the number of threads to use, 0 for the hardware concurrency
+        unsigned int threads{0};
+        /// the smallest number of catalog entries searched by a thread
+        std::size_t minimumShardSize{8192};
+    };
+
+    /** find the entries of a catalog most similar to a query
+    @details the catalog is split into contiguous shards searched in parallel,
+    each thread keeps a bounded heap of its best candidates and rejects
+    entries from length and character histogram bounds before scoring them.
+    The shard results are merged so the result does not depend on the number
+    of threads
+    @param scorer the scorer holding the preprocessed query
+    @param catalog the strings to search
+    @param count the maximum number of results
+    @param options the search options
+    @return the indices into catalog and scores of the best matches ordered
+    from most to least similar, ties are ordered by index
+    */
+    std::vector<ScoredCandidate> fuzzySearch(
+        const SimilarityScorer& scorer,
+        std::span<const std::string_view> catalog,
+        std::size_t count,
+        const FuzzySearchOptions& options = {});
+
+    /** find the entries of a catalog most similar to a query
+    @details the comparison ignores case by default like findCloseStringMatch
+    @param query the string to search for
+    @param catalog the strings to search
+    @param count the maximum number of results
+    @param metric the similarity measure to use
+    @param options the search options
+    */
+    std::vector<ScoredCandidate> fuzzySearch(
+        std::string_view query,
+        std::span<const std::string_view> catalog,
+        std::size_t count,
+        similarity_metric metric = similarity_metric::jaro_winkler,
+        const FuzzySearchOptions& options = {});
+}  // namespace similarity
+}  // namespace gmlc::utilities
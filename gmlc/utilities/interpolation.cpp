@@ -0,0 +1,94 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "interpolation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/* The segment evaluation kernels are compiled with GCC on x86-64 Linux for
+AVX-512, AVX2 and the baseline SSE2 with the best version selected when the
+program is loaded, the polynomial templates are inlined into each version*/
+
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC diagnostic ignored "-Wpsabi"
+#    if defined(__x86_64__) && defined(__linux__)
+#        define GMLC_UTILITIES_INTERPOLATION_KERNEL                            \
+            __attribute__((target_clones("avx512f", "avx2", "default")))
+#    endif
+#    define GMLC_UTILITIES_ALWAYS_INLINE [[gnu::always_inline]] inline
+#    define GMLC_UTILITIES_FLATTEN [[gnu::flatten]]
+#else
+#    define GMLC_UTILITIES_ALWAYS_INLINE inline
+#    define GMLC_UTILITIES_FLATTEN
+#endif
+#ifndef GMLC_UTILITIES_INTERPOLATION_KERNEL
+#    define GMLC_UTILITIES_INTERPOLATION_KERNEL
+#endif
+
+namespace gmlc::utilities::interpolationDetail {
+namespace {
+    template<class X>
+    GMLC_UTILITIES_ALWAYS_INLINE void evaluateDegree(
+        int degree,
+        const X* times,
+        const std::uint32_t* segments,
+        std::size_t count,
+        const X* breaks,
+        const X* a,
+        const X* b,
+        const X* c,
+        const X* d,
+        X* out)
+    {
+        switch (degree) {
+            case 0:
+                evaluateSegments<0>(
+                    times, segments, count, breaks, a, b, c, d, out);
+                break;
+            case 1:
+                evaluateSegments<1>(
+                    times, segments, count, breaks, a, b, c, d, out);
+                break;
+            default:
+                evaluateSegments<3>(
+                    times, segments, count, breaks, a, b, c, d, out);
+                break;
+        }
+    }
+}  // namespace
+
+GMLC_UTILITIES_INTERPOLATION_KERNEL GMLC_UTILITIES_FLATTEN
+void evaluateKernel(
+    int degree,
+    const double* times,
+    const std::uint32_t* segments,
+    std::size_t count,
+    const double* breaks,
+    const double* a,
+    const double* b,
+    const double* c,
+    const double* d,
+    double* out)
+{
+    evaluateDegree(degree, times, segments, count, breaks, a, b, c, d, out);
+}
+GMLC_UTILITIES_INTERPOLATION_KERNEL GMLC_UTILITIES_FLATTEN
+void evaluateKernel(
+    int degree,
+    const float* times,
+    const std::uint32_t* segments,
+    std::size_t count,
+    const float* breaks,
+    const float* a,
+    const float* b,
+    const float* c,
+    const float* d,
+    float* out)
+{
+    evaluateDegree(degree, times, segments, count, breaks, a, b, c, d, out);
+}
+}  // namespace gmlc::utilities::interpolationDetail
@@ -0,0 +1,487 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define an interpolation engine over a table of points supporting
+ *  linear, nearest, previous value, monotone cubic and natural cubic spline
+ *  interpolation
+ *  @details the table is converted once into a piecewise polynomial, one
+ *  segment starting at each breakpoint, so evaluating a point is a segment
+ *  lookup and a short polynomial with no divisions
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace gmlc::utilities {
+/** the interpolation schemes of Interpolator*/
+enum class interpolation_method : std::uint8_t {
+    /// straight lines between the points
+    linear,
+    /// the value of the closest point, halfway takes the later point
+    nearest,
+    /// the value of the last point at or before the time, a zero order hold
+    previous,
+    /// piecewise cubic Hermite with the Fritsch-Carlson slopes, which keeps
+    /// monotone data monotone and does not overshoot
+    pchip,
+    /// cubic spline with zero second derivative at both ends
+    natural_spline
+};
+
+namespace interpolationDetail {
+    /** the number of outputs whose segments are located at once*/
+    constexpr std::size_t chunkSize{1024};
+
+    /** evaluate the segment polynomials at count times
+    @details segment s starts at breaks[s] and has the value
+    a[s] + dt * (b[s] + dt * (c[s] + dt * d[s])) with dt = time - breaks[s],
+    the higher coefficients are skipped below the degree 3*/
+    template<int Degree, class X>
+    void evaluateSegments(
+        const X* times,
+        const std::uint32_t* segments,
+        std::size_t count,
+        const X* breaks,
+        const X* a,
+        const X* b,
+        const X* c,
+        const X* d,
+        X* out)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            const std::uint32_t seg = segments[ii];
+            if constexpr (Degree == 0) {
+                out[ii] = a[seg];
+            } else if constexpr (Degree == 1) {
+                out[ii] = a[seg] + (times[ii] - breaks[seg]) * b[seg];
+            } else {
+                const X dt = times[ii] - breaks[seg];
+                out[ii] =
+                    a[seg] + dt * (b[seg] + dt * (c[seg] + dt * d[seg]));
+            }
+        }
+    }
+
+    /** evaluateSegments compiled for several instruction sets in
+    interpolation.cpp*/
+    void evaluateKernel(
+        int degree,
+        const double* times,
+        const std::uint32_t* segments,
+        std::size_t count,
+        const double* breaks,
+        const double* a,
+        const double* b,
+        const double* c,
+        const double* d,
+        double* out);
+    void evaluateKernel(
+        int degree,
+        const float* times,
+        const std::uint32_t* segments,
+        std::size_t count,
+        const float* breaks,
+        const float* a,
+        const float* b,
+        const float* c,
+        const float* d,
+        float* out);
+
+    /** the index of the last break at or before time, 0 before the first
+    @details a binary search with a fixed number of steps and no branches on
+    the data so unsorted times do not cause mispredictions*/
+    template<class X>
+    std::uint32_t locate(std::span<const X> breaks, X time)
+    {
+        std::size_t base{0};
+        std::size_t length{breaks.size()};
+        while (length > 1) {
+            const std::size_t half = length / 2;
+            base = (breaks[base + half] <= time) ? base + half : base;
+            length -= half;
+        }
+        return static_cast<std::uint32_t>(base);
+    }
+
+    /** the Fritsch-Carlson slope at an end point from the one sided three
+    point formula, limited so the end segment stays monotone*/
+    template<class X>
+    X pchipEndSlope(X h0, X h1, X delta0, X delta1)
+    {
+        const X slope = ((2 * h0 + h1) * delta0 - h0 * delta1) / (h0 + h1);
+        if (std::signbit(slope) != std::signbit(delta0) || delta0 == X(0)) {
+            return X(0);
+        }
+        if (std::signbit(delta0) != std::signbit(delta1) &&
+            std::abs(slope) > 3 * std::abs(delta0)) {
+            return 3 * delta0;
+        }
+        return slope;
+    }
+}  // namespace interpolationDetail
+
+/** interpolate a table of points with one of several schemes
+@details the constructor computes the polynomial coefficients of every
+segment once. Times before the first point use the first segment and times
+after the last point extend the last segment, so linear and cubic schemes
+extrapolate as interpolateLinear does and the others hold the end values.
+The linear scheme also accepts repeated times as a step change, the zero
+width segments are skipped and a time at the step takes the value before it.
+Evaluating many times locates their segments in chunks, with a merged walk
+when a chunk is sorted and a branch free binary search otherwise, then
+evaluates the polynomials in a vectorized loop
+@tparam X float or double*/
+template<class X>
+class Interpolator {
+    static_assert(
+        std::is_same_v<X, double> || std::is_same_v<X, float>,
+        "Interpolator requires double or float values");
+
+  public:
+    /** construct from a table of points
+    @param times the times of the points, strictly increasing, or non
+    decreasing for the linear scheme
+    @param values the values at the times, only the first
+    min(times.size(), values.size()) points are used
+    @param method the interpolation scheme
+    @throw std::invalid_argument if there are no points or the times are not
+    increasing*/
+    Interpolator(
+        std::span<const X> times,
+        std::span<const X> values,
+        interpolation_method method = interpolation_method::linear):
+        scheme(method)
+    {
+        const std::size_t count = (std::min)(times.size(), values.size());
+        if (count == 0) {
+            throw std::invalid_argument("interpolation requires a point");
+        }
+        if (count > (std::numeric_limits<std::uint32_t>::max)()) {
+            throw std::invalid_argument("too many interpolation points");
+        }
+        const bool steps = (method == interpolation_method::linear);
+        for (std::size_t ii = 1; ii < count; ++ii) {
+            // written so a NaN time also fails
+            if (steps ? !(times[ii - 1] <= times[ii]) :
+                        !(times[ii - 1] < times[ii])) {
+                throw std::invalid_argument(
+                    steps ? "interpolation times must not decrease" :
+                            "interpolation times must be strictly increasing");
+            }
+        }
+        build(times.first(count), values.first(count));
+    }
+    /** construct from vectors of times and values*/
+    Interpolator(
+        const std::vector<X>& times,
+        const std::vector<X>& values,
+        interpolation_method method = interpolation_method::linear):
+        Interpolator(
+            std::span<const X>(times),
+            std::span<const X>(values),
+            method)
+    {
+    }
+
+    /** interpolate the value at a single time*/
+    X operator()(X time) const
+    {
+        const std::uint32_t seg =
+            interpolationDetail::locate(std::span<const X>(bounds), time);
+        X result{0};
+        interpolationDetail::evaluateKernel(
+            degree(),
+            &time,
+            &seg,
+            1,
+            breaks.data(),
+            a.data(),
+            b.data(),
+            c.data(),
+            d.data(),
+            &result);
+        return result;
+    }
+
+    /** interpolate the values at a set of times, in any order
+    @param times the times to evaluate
+    @param[out] out the results, the first min(times.size(), out.size())
+    are written
+    @return the number of values written*/
+    std::size_t evaluate(std::span<const X> times, std::span<X> out) const
+    {
+        const std::size_t count = (std::min)(times.size(), out.size());
+        const std::span<const X> allBounds(bounds);
+        std::array<std::uint32_t, interpolationDetail::chunkSize> segments;
+        for (std::size_t start = 0; start < count;
+             start += interpolationDetail::chunkSize) {
+            const std::size_t length =
+                (std::min)(interpolationDetail::chunkSize, count - start);
+            const auto chunk = times.subspan(start, length);
+            if (std::is_sorted(chunk.begin(), chunk.end())) {
+                // walk forward from the segment of the first time
+                std::size_t seg =
+                    interpolationDetail::locate(allBounds, chunk.front());
+                for (std::size_t ii = 0; ii < length; ++ii) {
+                    while (seg + 1 < bounds.size() &&
+                           bounds[seg + 1] <= chunk[ii]) {
+                        ++seg;
+                    }
+                    segments[ii] = static_cast<std::uint32_t>(seg);
+                }
+            } else {
+                for (std::size_t ii = 0; ii < length; ++ii) {
+                    segments[ii] =
+                        interpolationDetail::locate(allBounds, chunk[ii]);
+                }
+            }
+            interpolationDetail::evaluateKernel(
+                degree(),
+                chunk.data(),
+                segments.data(),
+                length,
+                breaks.data(),
+                a.data(),
+                b.data(),
+                c.data(),
+                d.data(),
+                out.data() + start);
+        }
+        return count;
+    }
+
+    /** interpolate the values at a set of times into a new vector*/
+    std::vector<X> evaluate(std::span<const X> times) const
+    {
+        std::vector<X> out(times.size());
+        evaluate(times, std::span<X>(out));
+        return out;
+    }
+
+    /** interpolate the values at a vector of times*/
+    std::vector<X> evaluate(const std::vector<X>& times) const
+    {
+        return evaluate(std::span<const X>(times));
+    }
+
+    /** get the interpolation scheme*/
+    interpolation_method method() const { return scheme; }
+    /** get the number of segments, one per point except the repeated times of
+    a step*/
+    std::size_t size() const { return breaks.size(); }
+
+  private:
+    /** the degree of the segment polynomials*/
+    int degree() const
+    {
+        switch (scheme) {
+            case interpolation_method::nearest:
+            case interpolation_method::previous:
+                return 0;
+            case interpolation_method::linear:
+                return 1;
+            default:
+                return 3;
+        }
+    }
+
+    void build(std::span<const X> times, std::span<const X> values)
+    {
+        const std::size_t count = times.size();
+        breaks.assign(times.begin(), times.end());
+        a.assign(values.begin(), values.end());
+        b.assign(count, X(0));
+        c.assign(count, X(0));
+        d.assign(count, X(0));
+        if (scheme == interpolation_method::nearest) {
+            // each value holds from the midpoint before its time
+            for (std::size_t ii = 1; ii < count; ++ii) {
+                breaks[ii] = times[ii - 1] + (times[ii] - times[ii - 1]) / 2;
+            }
+            bounds = breaks;
+            return;
+        }
+        bounds = breaks;
+        if (scheme == interpolation_method::previous || count == 1) {
+            return;
+        }
+        std::vector<X> widths(count - 1);
+        std::vector<X> deltas(count - 1);
+        for (std::size_t ii = 0; ii + 1 < count; ++ii) {
+            widths[ii] = times[ii + 1] - times[ii];
+            deltas[ii] = (values[ii + 1] - values[ii]) / widths[ii];
+        }
+        if (scheme == interpolation_method::linear) {
+            std::copy(deltas.begin(), deltas.end(), b.begin());
+            removeSteps();
+        } else if (count == 2) {
+            std::copy(deltas.begin(), deltas.end(), b.begin());
+            b.back() = deltas.back();
+        } else if (scheme == interpolation_method::pchip) {
+            buildPchip(widths, deltas);
+        } else {
+            buildNaturalSpline(widths, deltas);
+        }
+    }
+
+    /** drop the zero width segments of repeated times from a linear table
+    @details the segment after a step is located from just past the step time
+    so a time at the step stays on the segment before it, the last point
+    continues the last segment with a width*/
+    void removeSteps()
+    {
+        std::size_t kept{0};
+        for (std::size_t ii = 0; ii < breaks.size(); ++ii) {
+            if (ii + 1 < breaks.size() && breaks[ii] == breaks[ii + 1]) {
+                continue;
+            }
+            bounds[kept] = breaks[ii];
+            if (ii > 0 && breaks[ii - 1] == breaks[ii]) {
+                bounds[kept] = std::nextafter(
+                    breaks[ii], std::numeric_limits<X>::infinity());
+            }
+            breaks[kept] = breaks[ii];
+            a[kept] = a[ii];
+            b[kept] = b[ii];
+            ++kept;
+        }
+        b[kept - 1] = (kept > 1) ? b[kept - 2] : X(0);
+        for (auto* column : {&bounds, &breaks, &a, &b, &c, &d}) {
+            column->resize(kept);
+        }
+    }
+
+    /** convert the slopes at the points in b into cubic Hermite segments*/
+    void hermiteSegments(std::span<const X> widths, std::span<const X> deltas)
+    {
+        for (std::size_t ii = 0; ii < widths.size(); ++ii) {
+            const X h = widths[ii];
+            c[ii] = (3 * deltas[ii] - 2 * b[ii] - b[ii + 1]) / h;
+            d[ii] = (b[ii] + b[ii + 1] - 2 * deltas[ii]) / (h * h);
+        }
+        // the last point continues the last segment
+        const std::size_t last = widths.size() - 1;
+        c.back() = c[last] + 3 * d[last] * widths[last];
+        d.back() = d[last];
+    }
+
+    void buildPchip(std::span<const X> widths, std::span<const X> deltas)
+    {
+        const std::size_t last = widths.size();
+        for (std::size_t ii = 1; ii < last; ++ii) {
+            const X before = deltas[ii - 1];
+            const X after = deltas[ii];
+            if (before == X(0) || after == X(0) ||
+                std::signbit(before) != std::signbit(after)) {
+                // a local extremum or flat section
+                continue;
+            }
+            // the weighted harmonic mean of the neighboring slopes
+            const X weight1 = 2 * widths[ii] + widths[ii - 1];
+            const X weight2 = widths[ii] + 2 * widths[ii - 1];
+            b[ii] = (weight1 + weight2) / (weight1 / before + weight2 / after);
+        }
+        b.front() = interpolationDetail::pchipEndSlope(
+            widths[0], widths[1], deltas[0], deltas[1]);
+        b.back() = interpolationDetail::pchipEndSlope(
+            widths[last - 1],
+            widths[last - 2],
+            deltas[last - 1],
+            deltas[last - 2]);
+        hermiteSegments(widths, deltas);
+    }
+
+    void buildNaturalSpline(
+        std::span<const X> widths,
+        std::span<const X> deltas)
+    {
+        // solve the tridiagonal system for the second derivatives of the
+        // interior points with the Thomas algorithm, the ends are 0
+        const std::size_t count = widths.size() + 1;
+        std::vector<X> second(count, X(0));
+        std::vector<X> diagonal(count, X(0));
+        for (std::size_t ii = 1; ii + 1 < count; ++ii) {
+            diagonal[ii] = 2 * (widths[ii - 1] + widths[ii]);
+            second[ii] = 6 * (deltas[ii] - deltas[ii - 1]);
+            if (ii > 1) {
+                const X factor = widths[ii - 1] / diagonal[ii - 1];
+                diagonal[ii] -= factor * widths[ii - 1];
+                second[ii] -= factor * second[ii - 1];
+            }
+        }
+        for (std::size_t ii = count - 1; ii-- > 1;) {
+            second[ii] =
+                (second[ii] - widths[ii] * second[ii + 1]) / diagonal[ii];
+        }
+        for (std::size_t ii = 0; ii + 1 < count; ++ii) {
+            b[ii] = deltas[ii] -
+                widths[ii] * (2 * second[ii] + second[ii + 1]) / 6;
+            c[ii] = second[ii] / 2;
+            d[ii] = (second[ii + 1] - second[ii]) / (6 * widths[ii]);
+        }
+        // the last point continues the last segment, its second derivative
+        // is 0 so c stays 0
+        const std::size_t last = count - 2;
+        b.back() = b[last] +
+            widths[last] * (2 * c[last] + 3 * d[last] * widths[last]);
+        d.back() = d[last];
+    }
+
+    interpolation_method scheme;  //!< the interpolation scheme
+    std::vector<X> breaks;  //!< the start of each segment
+    /// the first time located in each segment, after the time of a step
+    std::vector<X> bounds;
+    std::vector<X> a;  //!< the value at the start of each segment
+    std::vector<X> b;  //!< the first derivative coefficients
+    std::vector<X> c;  //!< the second order coefficients
+    std::vector<X> d;  //!< the third order coefficients
+};
+
+/** interpolate a table of points at a set of times
+@details builds an Interpolator, use one directly to evaluate the same
+table more than once
+@param times the times of the points, strictly increasing, or non decreasing
+for the linear scheme
+@param values the values at the times
+@param timeOut the times to evaluate, in any order
+@param method the interpolation scheme
+@return the interpolated values at timeOut*/
+template<class X>
+std::vector<X> interpolate(
+    std::span<const X> times,
+    std::span<const X> values,
+    std::span<const X> timeOut,
+    interpolation_method method = interpolation_method::linear)
+{
+    return Interpolator<X>(times, values, method).evaluate(timeOut);
+}
+
+/** interpolate a table of points held in vectors at a set of times*/
+template<class X>
+std::vector<X> interpolate(
+    const std::vector<X>& times,
+    const std::vector<X>& values,
+    const std::vector<X>& timeOut,
+    interpolation_method method = interpolation_method::linear)
+{
+    return interpolate(
+        std::span<const X>(times),
+        std::span<const X>(values),
+        std::span<const X>(timeOut),
+        method);
+}
+}  // namespace gmlc::utilities
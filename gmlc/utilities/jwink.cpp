@@ -1,153 +1,234 @@
 /*
-Copyright (c) 2017-2019,
+Copyright (c) 2017-2026,
 Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
 for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
 All rights reserved. SPDX-License-Identifier: BSD-3-Clause
 */
-#include "namecmp.h"
-#include "string_viewDef.h"
+#include "similarity.h"
 
 #include <algorithm>
-#include <cctype>
-#include <cstdarg>
-#include <cstdio>
-#include <cstring>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
 
-namespace gmlc {
-namespace utilities {
-    bool strIeq(string_view str1, string_view str2)
+/* the matching characters are found with bit masks of the positions of each
+character in the pattern, the candidates for a text character are the unmatched
+positions of that character inside the match window so the first match is the
+lowest set bit of a few words instead of a scan of the window*/
+
+namespace gmlc::utilities::similarity {
+namespace {
+    constexpr std::size_t wordBits{64};
+    constexpr std::size_t maxWinklerPrefix{4};
+    constexpr double winklerScale{0.1};
+
+    constexpr std::size_t charIndex(char testChar) noexcept
     {
-        if (str1 == str2) {
-            return true;
-        }
-        if (str1.size() != str2.size()) {
-            return false;
-        }
-        return std::equal(
-            str1.begin(), str1.end(), str2.begin(), [](char c1, char c2) {
-                if (c1 == c2) {
-                    return true;
-                }
-                if (c1 - c2 == 'A' - 'a') {
-                    return (c1 >= 'A' && c1 <= 'Z');
-                }
-                if (c2 - c1 == 'A' - 'a') {
-                    return (c2 >= 'A' && c2 <= 'Z');
-                }
-                return false;
-            });
+        return static_cast<unsigned char>(testChar);
     }
 
-    float jaro_winkler_comp(string_view s1, string_view s2)
+    constexpr bool charEqual(
+        char char1,
+        char char2,
+        case_sensitivity sensitivity) noexcept
     {
-        float Result = 0.0F;
-        char use_winkler = 1;
-        const int enhance_first_i = 4;
-
-        int i, j;
-        int len_s1, len_s2;
-        int half_length = 0;
-        int len_max = 0, len_min = 0;
-        char c1, c2;
-        float wink_adj = 0.0f;
-        int f = 0; /*the number of first character matches*/
-
-        char str_large[26]; /*26 instead of 25 to accommodate a termination
-                               Character*/
-        char str_small[26];
-        int j_max = 0;
-        int j_min = 0;
-        int c = 0; /*common characters*/
-        int t = 0; /*common transpositions*/
-        int last_match_i = 0;
-
-        /*first check if we have an exact match*/
-        if (strIeq(s1, s2)) {
-            return 1.0F;
-        }
-        len_s1 = static_cast<int>(s1.size());
-        len_s2 = static_cast<int>(s1.size());
+        return (sensitivity == case_sensitivity::sensitive) ?
+            char1 == char2 :
+            charIeq(char1, char2);
+    }
 
-        /*the original code checks for a NULL value which won't happen here*/
-        if (len_s1 > len_s2) {
-            strncpy(str_large, s1.data(), 25);
-            strncpy(str_small, s2.data(), 25);
-            len_s1 = (std::min)(len_s1, 25);
-            len_s2 = (std::min)(len_s2, 25);
-            len_max = len_s1;
-            len_min = len_s2;
-            half_length = len_s2 / 2 - 1;
-        } else {
-            strncpy(str_small, s1.data(), 25);
-            strncpy(str_large, s2.data(), 25);
-            len_s1 = (std::min)(len_s1, 25);
-            len_s2 = (std::min)(len_s2, 25);
-            len_max = len_s2;
-            len_min = len_s1;
-            half_length = len_s1 / 2 - 1;
-        }
-        /*convert to all lower case*/
-        for (i = 0; i < len_min; i++) {
-            str_small[i] = static_cast<char>(tolower(str_small[i]));
+    /** compute the Jaro-Winkler similarity of a pattern and a text
+    @param matchTable the match table of the pattern
+    @param matched a zeroed word for each block of 64 pattern characters
+    @param matchedText space for a character for each pattern character
+    */
+    double jaroWinklerScore(
+        const std::uint64_t* matchTable,
+        std::string_view pattern,
+        std::string_view text,
+        case_sensitivity sensitivity,
+        std::uint64_t* matched,
+        char* matchedText)
+    {
+        if (pattern.empty() || text.empty()) {
+            return (pattern.empty() && text.empty()) ? 1.0 : 0.0;
         }
-        for (i = 0; i < len_max; i++) {
-            str_large[i] = static_cast<char>(tolower(str_large[i]));
+        if (pattern.size() == text.size() &&
+            ((sensitivity == case_sensitivity::sensitive) ?
+                 pattern == text :
+                 strIeq(pattern, text))) {
+            return 1.0;
         }
-        /*compute the jaro value*/
-        for (i = 1; i < len_min; i++) {
-            c1 = str_small[i];
-            c2 = str_large[i];
-            if (c1 == c2) {
-                c++;
-                last_match_i = i;
-                if ((i < enhance_first_i + 1) && (use_winkler)) {
-                    if (f == i - 1) {
-                        f++;
-                    }
-                }
-            } else {
-                j_max = i + half_length;
-                if (j_max > len_max - 1) {
-                    j_max = len_max - 1;
+        const std::size_t longest = (std::max)(pattern.size(), text.size());
+        const std::size_t window = (longest >= 2U) ? longest / 2U - 1U : 0U;
+
+        std::size_t matches{0};
+        for (std::size_t jj = 0; jj < text.size(); ++jj) {
+            const std::size_t low = (jj > window) ? jj - window : 0U;
+            if (low >= pattern.size()) {
+                break;
+            }
+            const std::size_t high =
+                (std::min)(jj + window, pattern.size() - 1);
+            const std::uint64_t* masks = matchTable + charIndex(text[jj]);
+            for (std::size_t word = low / wordBits; word <= high / wordBits;
+                 ++word) {
+                std::uint64_t candidates =
+                    masks[word * detail::matchTableBlockSize] & ~matched[word];
+                if (word == low / wordBits) {
+                    candidates &= ~std::uint64_t{0} << (low % wordBits);
                 }
-                j_min = i - half_length;
-                if (j_min < 0) {
-                    j_min = 0;
+                if (word == high / wordBits) {
+                    candidates &=
+                        ~std::uint64_t{0} >> (wordBits - 1 - high % wordBits);
                 }
-                for (j = j_min; j <= j_max; j++) {
-                    if (i != j) {
-                        c2 = str_large[j];
-                        if (c1 == c2) {
-                            c++;
-                            if (last_match_i > j) {
-                                t++;
-                            }
-                            last_match_i = j;
-                            break;
-                        }
-                    }
+                if (candidates != 0) {
+                    // take the first unmatched position
+                    matched[word] |= candidates & (~candidates + 1);
+                    matchedText[matches] = text[jj];
+                    ++matches;
+                    break;
                 }
             }
         }
-        t = c - t;
-        if (c == 0) {
-            Result = 0.0F;
-            return (Result);
+        if (matches == 0) {
+            return 0.0;
         }
-        // printf("c=%d, t=%d, l1=%d, l2=%d, f=%d, half_length=%d\n",c,t,len_s1,
-        // len_s2,f,half_length);
-        Result = ((static_cast<float>(c) / static_cast<float>(len_s1)) +
-                  (static_cast<float>(c) / static_cast<float>(len_s2)) +
-                  (static_cast<float>(t) / static_cast<float>(c))) /
-            3.0F;
+        // compare the matched characters of both strings in order
+        std::size_t transpositions{0};
+        std::size_t textIndex{0};
+        const std::size_t words = (pattern.size() + wordBits - 1) / wordBits;
+        for (std::size_t word = 0; word < words; ++word) {
+            for (std::uint64_t bits = matched[word]; bits != 0;
+                 bits &= bits - 1) {
+                const std::size_t position = word * wordBits +
+                    static_cast<std::size_t>(std::countr_zero(bits));
+                if (!charEqual(
+                        pattern[position],
+                        matchedText[textIndex],
+                        sensitivity)) {
+                    ++transpositions;
+                }
+                ++textIndex;
+            }
+        }
+        const auto common = static_cast<double>(matches);
+        const auto halfTranspositions =
+            static_cast<double>(transpositions / 2);
+        const double jaro = (common / static_cast<double>(pattern.size()) +
+                             common / static_cast<double>(text.size()) +
+                             (common - halfTranspositions) / common) /
+            3.0;
 
-        if (use_winkler) {
-            wink_adj = Result + f * 0.1F * (1.0F - Result);
-            Result = wink_adj;
+        std::size_t prefix{0};
+        const std::size_t prefixLimit =
+            (std::min)({maxWinklerPrefix, pattern.size(), text.size()});
+        while (prefix < prefixLimit &&
+               charEqual(pattern[prefix], text[prefix], sensitivity)) {
+            ++prefix;
         }
+        return jaro + static_cast<double>(prefix) * winklerScale * (1.0 - jaro);
+    }
+}  // namespace
 
-        return (Result);
+double jaroWinkler(
+    std::string_view str1,
+    std::string_view str2,
+    case_sensitivity sensitivity)
+{
+    // the similarity is symmetric so the pattern is the shorter string
+    if (str1.size() > str2.size()) {
+        std::swap(str1, str2);
+    }
+    if (str1.size() <= wordBits) {
+        std::array<std::uint64_t, detail::matchTableBlockSize> matchTable{};
+        detail::buildMatchTable(str1, sensitivity, matchTable.data());
+        std::uint64_t matched{0};
+        std::array<char, wordBits> matchedText{};
+        return jaroWinklerScore(
+            matchTable.data(),
+            str1,
+            str2,
+            sensitivity,
+            &matched,
+            matchedText.data());
+    }
+    return JaroWinklerPattern(str1, sensitivity).similarity(str2);
+}
+
+JaroWinklerPattern::JaroWinklerPattern(
+    std::string_view pattern,
+    case_sensitivity sensitivity) :
+    patternString(pattern),
+    matchTable(
+        ((pattern.size() + wordBits - 1) / wordBits) *
+            detail::matchTableBlockSize,
+        0),
+    caseSensitivity(sensitivity)
+{
+    detail::buildMatchTable(pattern, sensitivity, matchTable.data());
+}
+
+double JaroWinklerPattern::similarity(std::string_view text) const
+{
+    if (patternString.size() <= wordBits) {
+        std::uint64_t matched{0};
+        std::array<char, wordBits> matchedText{};
+        return jaroWinklerScore(
+            matchTable.data(),
+            patternString,
+            text,
+            caseSensitivity,
+            &matched,
+            matchedText.data());
+    }
+    std::vector<std::uint64_t> matched(
+        (patternString.size() + wordBits - 1) / wordBits, 0);
+    std::string matchedText(patternString.size(), '\0');
+    return jaroWinklerScore(
+        matchTable.data(),
+        patternString,
+        text,
+        caseSensitivity,
+        matched.data(),
+        matchedText.data());
+}
+
+void JaroWinklerPattern::similarity(
+    std::span<const std::string_view> texts,
+    std::span<double> scores) const
+{
+    if (texts.size() != scores.size()) {
+        throw(std::invalid_argument(
+            "scores must be the same size as the texts"));
+    }
+    // the working memory is allocated once for all the texts
+    std::vector<std::uint64_t> matched(
+        (patternString.size() + wordBits - 1) / wordBits, 0);
+    std::string matchedText(patternString.size(), '\0');
+    for (std::size_t ii = 0; ii < texts.size(); ++ii) {
+        std::fill(matched.begin(), matched.end(), std::uint64_t{0});
+        scores[ii] = jaroWinklerScore(
+            matchTable.data(),
+            patternString,
+            texts[ii],
+            caseSensitivity,
+            matched.data(),
+            matchedText.data());
     }
+}
 
-}  // namespace utilities
-}  // namespace gmlc
+std::vector<double> JaroWinklerPattern::similarity(
+    std::span<const std::string_view> texts) const
+{
+    std::vector<double> scores(texts.size());
+    similarity(texts, scores);
+    return scores;
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "numericParsing.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace gmlc::utilities {
+namespace {
+    struct Utf8Replacement {
+        std::string_view sequence;
+        char replacement;
+    };
+
+    // the non-ASCII characters that have an ASCII equivalent in numbers
+    constexpr std::array<Utf8Replacement, 11> numericReplacements{{
+        {"\xC2\xA0", ' '},  // no-break space
+        {"\xE2\x80\x87", ' '},  // figure space
+        {"\xE2\x80\x89", ' '},  // thin space
+        {"\xE2\x80\xAF", ' '},  // narrow no-break space
+        {"\xE3\x80\x80", ' '},  // ideographic space
+        {"\xE2\x88\x92", '-'},  // minus sign
+        {"\xEF\xBC\x8B", '+'},  // full-width plus
+        {"\xEF\xBC\x8D", '-'},  // full-width hyphen-minus
+        {"\xEF\xBC\x8E", '.'},  // full-width full stop
+        {"\xEF\xBC\xA5", 'E'},  // full-width E
+        {"\xEF\xBD\x85", 'e'},  // full-width e
+    }};
+
+    constexpr std::string_view byteOrderMark{"\xEF\xBB\xBF"};
+    // full-width digits are U+FF10 to U+FF19
+    constexpr std::string_view fullWidthDigitPrefix{"\xEF\xBC"};
+    constexpr unsigned char fullWidthZero{0x90};
+}  // namespace
+
+std::string normalizeNumericText(std::string_view input)
+{
+    if (input.substr(0, byteOrderMark.size()) == byteOrderMark) {
+        input.remove_prefix(byteOrderMark.size());
+    }
+    std::string result;
+    result.reserve(input.size());
+    std::size_t pos{0};
+    while (pos < input.size()) {
+        if (!numericParsingDetail::isNonAscii(input, pos)) {
+            result.push_back(input[pos]);
+            ++pos;
+            continue;
+        }
+        const auto remaining = input.substr(pos);
+        if (remaining.size() >= 3 &&
+            remaining.substr(0, 2) == fullWidthDigitPrefix) {
+            const auto digit =
+                static_cast<unsigned char>(remaining[2]) - fullWidthZero;
+            if (digit >= 0 && digit <= 9) {
+                result.push_back(static_cast<char>('0' + digit));
+                pos += 3;
+                continue;
+            }
+        }
+        bool replaced{false};
+        for (const auto& replacement : numericReplacements) {
+            if (remaining.substr(0, replacement.sequence.size()) ==
+                replacement.sequence) {
+                result.push_back(replacement.replacement);
+                pos += replacement.sequence.size();
+                replaced = true;
+                break;
+            }
+        }
+        if (!replaced) {
+            result.push_back(input[pos]);
+            ++pos;
+        }
+    }
+    std::size_t leadingSpace{0};
+    while (leadingSpace < result.size() &&
+           numericParsingDetail::isCSpace(result[leadingSpace])) {
+        ++leadingSpace;
+    }
+    result.erase(0, leadingSpace);
+    return result;
+}
+}  // namespace gmlc::utilities
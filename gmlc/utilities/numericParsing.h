@@ -0,0 +1,660 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define numeric conversions from strings that do not throw
+ *  exceptions
+ */
+#pragma once
+
+#include "charMapper.h"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if !defined(__cpp_lib_to_chars) || (__cpp_lib_to_chars < 201611L)
+#include <locale>
+#include <sstream>
+#endif
+
+namespace gmlc::utilities {
+/// map of the characters that can start a number
+inline constexpr CharMapper<bool> numCheck = numericStartMapper();
+/// map of the characters that can end a number
+inline constexpr CharMapper<bool> numCheckEnd = numericEndMapper();
+
+/** the result of a numeric conversion which does not throw
+@details ec is std::errc{} if the conversion succeeded,
+std::errc::invalid_argument if no number could be converted and
+std::errc::result_out_of_range if the number is not representable in the
+requested type
+*/
+template<typename X>
+struct NumericConversionResult {
+    X value{0};  //!< the converted value
+    std::size_t charactersUsed{0};  //!< the number of characters consumed
+    std::errc ec{};  //!< the error code of the conversion
+    /** check if the conversion was successful*/
+    constexpr explicit operator bool() const noexcept
+    {
+        return ec == std::errc{};
+    }
+};
+
+namespace numericParsingDetail {
+    /** check for whitespace as defined by the "C" locale*/
+    constexpr bool isCSpace(char testChar) noexcept
+    {
+        return testChar == ' ' || testChar == '\t' || testChar == '\n' ||
+            testChar == '\r' || testChar == '\v' || testChar == '\f';
+    }
+
+    /** check if the character at a position is part of a multibyte UTF-8
+    sequence*/
+    constexpr bool isNonAscii(std::string_view V, std::size_t pos) noexcept
+    {
+        return pos < V.size() && static_cast<unsigned char>(V[pos]) >= 0x80U;
+    }
+
+    constexpr bool hasNonAscii(std::string_view V) noexcept
+    {
+        for (std::size_t pos = 0; pos < V.size(); ++pos) {
+            if (isNonAscii(V, pos)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** throw the exception matching a conversion error code if there is one
+    @throw std::out_of_range for std::errc::result_out_of_range
+    @throw std::invalid_argument for any other error
+    */
+    constexpr void checkConversionError(std::errc ec)
+    {
+        if (ec == std::errc{}) {
+            return;
+        }
+        if (ec == std::errc::result_out_of_range) {
+            throw(std::out_of_range(
+                "conversion type does not support the string conversion"));
+        }
+        throw(std::invalid_argument("unable to convert string"));
+    }
+
+    /** parse a base 10 integer with the same syntax and results as
+    std::from_chars, usable in constant expressions*/
+    template<typename X>
+    constexpr NumericConversionResult<X>
+        parseDecimalInteger(std::string_view input) noexcept
+    {
+        using unsignedX = std::make_unsigned_t<X>;
+        NumericConversionResult<X> result;
+        std::size_t pos{0};
+        bool negative{false};
+        if constexpr (std::is_signed_v<X>) {
+            if (!input.empty() && input.front() == '-') {
+                negative = true;
+                pos = 1;
+            }
+        }
+        const auto limit = static_cast<unsignedX>(
+            static_cast<unsignedX>((std::numeric_limits<X>::max)()) +
+            (negative ? 1U : 0U));
+        const std::size_t firstDigit{pos};
+        unsignedX value{0};
+        bool overflow{false};
+        while (pos < input.size() && input[pos] >= '0' && input[pos] <= '9') {
+            const auto digit = static_cast<unsignedX>(input[pos] - '0');
+            if (value > (limit - digit) / 10U) {
+                overflow = true;
+            } else if (!overflow) {
+                value = static_cast<unsignedX>(value * 10U + digit);
+            }
+            ++pos;
+        }
+        if (pos == firstDigit) {
+            result.ec = std::errc::invalid_argument;
+            return result;
+        }
+        result.charactersUsed = pos;
+        if (overflow) {
+            result.ec = std::errc::result_out_of_range;
+            return result;
+        }
+        result.value = negative ? static_cast<X>(0U - value) :
+                                  static_cast<X>(value);
+        return result;
+    }
+
+    /** this function is intentionally not constexpr, it is called in a
+    constant expression when a floating point string cannot be converted
+    exactly at compile time so the constant evaluation fails*/
+    inline void constexprFloatConversionNotExact() {}
+
+    constexpr bool startsWithNoCase(
+        std::string_view input,
+        std::string_view lowerCaseMatch) noexcept
+    {
+        if (input.size() < lowerCaseMatch.size()) {
+            return false;
+        }
+        for (std::size_t ii = 0; ii < lowerCaseMatch.size(); ++ii) {
+            const char testChar = (input[ii] >= 'A' && input[ii] <= 'Z') ?
+                static_cast<char>(input[ii] - 'A' + 'a') :
+                input[ii];
+            if (testChar != lowerCaseMatch[ii]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** get the largest power of 10 that is exactly representable in X*/
+    template<typename X>
+    constexpr int maxExactPowerOf10() noexcept
+    {
+        // 10^k is exact if 5^k fits in the mantissa
+        X mantissaLimit{1};
+        for (int ii = 0; ii < std::numeric_limits<X>::digits; ++ii) {
+            mantissaLimit *= X{2};
+        }
+        X powerOf5{1};
+        int power{0};
+        while (powerOf5 * X{5} < mantissaLimit) {
+            powerOf5 *= X{5};
+            ++power;
+        }
+        return power;
+    }
+
+    template<typename X>
+    constexpr X powerOf10(int power) noexcept
+    {
+        X result{1};
+        for (int ii = 0; ii < power; ++ii) {
+            result *= X{10};
+        }
+        return result;
+    }
+
+    /** convert a string to a floating point value in a constant expression
+    @details uses the same syntax as std::from_chars. Values are computed with
+    a single correctly rounded multiplication or division of exact values
+    (Clinger's fast path) which covers numbers with up to about 15 significant
+    digits and moderate exponents. Other values cannot be converted exactly
+    without extended precision so they fail to compile rather than produce a
+    result that differs from the run time conversion
+    */
+    template<typename X>
+    constexpr NumericConversionResult<X>
+        parseFloatConstexpr(std::string_view input) noexcept
+    {
+        NumericConversionResult<X> result;
+        std::size_t pos{0};
+        const bool negative = !input.empty() && input.front() == '-';
+        if (negative) {
+            pos = 1;
+        }
+        const auto special = input.substr(pos);
+        if (startsWithNoCase(special, "inf")) {
+            result.value = negative ? -std::numeric_limits<X>::infinity() :
+                                      std::numeric_limits<X>::infinity();
+            result.charactersUsed =
+                pos + (startsWithNoCase(special, "infinity") ? 8U : 3U);
+            return result;
+        }
+        if (startsWithNoCase(special, "nan")) {
+            result.value = negative ? -std::numeric_limits<X>::quiet_NaN() :
+                                      std::numeric_limits<X>::quiet_NaN();
+            pos += 3;
+            if (pos < input.size() && input[pos] == '(') {
+                auto closePos = pos + 1;
+                while (closePos < input.size() &&
+                       ((input[closePos] >= '0' && input[closePos] <= '9') ||
+                        (input[closePos] >= 'a' && input[closePos] <= 'z') ||
+                        (input[closePos] >= 'A' && input[closePos] <= 'Z') ||
+                        input[closePos] == '_')) {
+                    ++closePos;
+                }
+                if (closePos < input.size() && input[closePos] == ')') {
+                    pos = closePos + 1;
+                }
+            }
+            result.charactersUsed = pos;
+            return result;
+        }
+        constexpr int maxMantissaDigits{19};
+        std::uint64_t mantissa{0};
+        int mantissaDigits{0};
+        int exponent{0};
+        bool exact{true};
+        bool anyDigits{false};
+        bool fraction{false};
+        while (pos < input.size()) {
+            const char testChar = input[pos];
+            if (testChar == '.' && !fraction) {
+                fraction = true;
+                ++pos;
+                continue;
+            }
+            if (testChar < '0' || testChar > '9') {
+                break;
+            }
+            anyDigits = true;
+            const auto digit = static_cast<std::uint64_t>(testChar - '0');
+            if (mantissa == 0 && digit == 0) {
+                // leading zeros only shift the decimal point
+                exponent -= fraction ? 1 : 0;
+            } else if (mantissaDigits < maxMantissaDigits) {
+                mantissa = mantissa * 10U + digit;
+                ++mantissaDigits;
+                exponent -= fraction ? 1 : 0;
+            } else {
+                exponent += fraction ? 0 : 1;
+                exact = exact && (digit == 0);
+            }
+            ++pos;
+        }
+        if (!anyDigits) {
+            result.ec = std::errc::invalid_argument;
+            return result;
+        }
+        if (pos < input.size() && (input[pos] == 'e' || input[pos] == 'E')) {
+            auto expPos = pos + 1;
+            int expSign{1};
+            if (expPos < input.size() &&
+                (input[expPos] == '-' || input[expPos] == '+')) {
+                expSign = (input[expPos] == '-') ? -1 : 1;
+                ++expPos;
+            }
+            if (expPos < input.size() && input[expPos] >= '0' &&
+                input[expPos] <= '9') {
+                int explicitExponent{0};
+                while (expPos < input.size() && input[expPos] >= '0' &&
+                       input[expPos] <= '9') {
+                    if (explicitExponent < 100000) {
+                        explicitExponent =
+                            explicitExponent * 10 + (input[expPos] - '0');
+                    }
+                    ++expPos;
+                }
+                exponent += expSign * explicitExponent;
+                pos = expPos;
+            }
+        }
+        result.charactersUsed = pos;
+        if (mantissa == 0) {
+            result.value = negative ? -X{0} : X{0};
+            return result;
+        }
+        constexpr int maxPower = maxExactPowerOf10<X>();
+        constexpr std::uint64_t maxMantissa =
+            (std::numeric_limits<X>::digits >= 64) ?
+            (std::numeric_limits<std::uint64_t>::max)() :
+            (std::uint64_t{1} << std::numeric_limits<X>::digits);
+        if (exact && mantissa <= maxMantissa) {
+            while (exponent > maxPower && mantissa <= maxMantissa / 10U) {
+                mantissa *= 10U;
+                --exponent;
+            }
+            if (exponent >= 0 && exponent <= maxPower) {
+                result.value =
+                    static_cast<X>(mantissa) * powerOf10<X>(exponent);
+                result.value = negative ? -result.value : result.value;
+                return result;
+            }
+            if (exponent < 0 && -exponent <= maxPower) {
+                result.value =
+                    static_cast<X>(mantissa) / powerOf10<X>(-exponent);
+                result.value = negative ? -result.value : result.value;
+                return result;
+            }
+        }
+        constexprFloatConversionNotExact();
+        result.ec = std::errc::not_supported;
+        return result;
+    }
+}  // namespace numericParsingDetail
+
+/** convert the leading part of a string_view to an integer without throwing
+@details leading spaces and leading zeros are skipped, a negative value
+requested as an unsigned type is converted through the signed type. The
+conversion can be used in constant expressions
+@param input the string to convert
+@return a NumericConversionResult with the value and characters consumed
+*/
+template<typename X>
+constexpr NumericConversionResult<X>
+    tryStrViewToInteger(std::string_view input) noexcept
+{
+    static_assert(std::is_integral_v<X>, "requested type is not integral");
+    NumericConversionResult<X> result;
+    std::size_t additionalChars{0};
+    if (input.size() > 1) {
+        while (input.front() == ' ') {
+            input.remove_prefix(1);
+            ++additionalChars;
+            if (input.empty()) {
+                result.charactersUsed = additionalChars;
+                return result;
+            }
+        }
+        if (input.size() > 1 && input.front() == '0' && input[1] != 'X' &&
+            input[1] != 'x') {
+            while (input.front() == '0') {
+                input.remove_prefix(1);
+                ++additionalChars;
+                if (input.empty()) {
+                    result.charactersUsed = additionalChars;
+                    return result;
+                }
+            }
+        }
+    }
+    result = numericParsingDetail::parseDecimalInteger<X>(input);
+    if (result.ec != std::errc::invalid_argument) {
+        result.charactersUsed += additionalChars;
+        return result;
+    }
+    if constexpr (std::is_unsigned_v<X>) {
+        if (input.size() > 1 && input.front() == '-') {
+            auto signedResult =
+                tryStrViewToInteger<std::make_signed_t<X>>(input);
+            result.value = static_cast<X>(signedResult.value);
+            result.charactersUsed = signedResult.charactersUsed +
+                ((signedResult.ec == std::errc{}) ? additionalChars : 0U);
+            result.ec = signedResult.ec;
+            return result;
+        }
+    }
+    return result;
+}
+
+/** convert the leading part of a string_view to a floating point value without
+throwing
+@details the conversion is independent of the current C or C++ locale
+@param input the string to convert
+@return a NumericConversionResult with the value and characters consumed
+*/
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+template<typename X>
+constexpr NumericConversionResult<X>
+    tryStrViewToFloat(std::string_view input) noexcept
+{
+    static_assert(
+        std::is_floating_point_v<X>, "requested type is not floating point");
+    if (std::is_constant_evaluated()) {
+        return numericParsingDetail::parseFloatConstexpr<X>(input);
+    }
+    NumericConversionResult<X> result;
+    auto conversionResult = std::from_chars(
+        input.data(), input.data() + input.size(), result.value);
+    result.ec = conversionResult.ec;
+    if (conversionResult.ec != std::errc::invalid_argument) {
+        result.charactersUsed =
+            static_cast<std::size_t>(conversionResult.ptr - input.data());
+    }
+    return result;
+}
+#else
+namespace numericParsingDetail {
+    template<typename X>
+    NumericConversionResult<X> streamToFloat(std::string_view input)
+    {
+        NumericConversionResult<X> result;
+        // from_chars does not skip whitespace so the stream should not either
+        if (input.empty() || isCSpace(input.front())) {
+            result.ec = std::errc::invalid_argument;
+            return result;
+        }
+        std::istringstream stream{std::string(input)};
+        stream.imbue(std::locale::classic());
+        stream >> result.value;
+        if (stream.fail()) {
+            result.ec = (result.value != X{0}) ?
+                std::errc::result_out_of_range :
+                std::errc::invalid_argument;
+        }
+        if (result.ec != std::errc::invalid_argument) {
+            result.charactersUsed = stream.eof() ?
+                input.size() :
+                static_cast<std::size_t>(stream.tellg());
+        }
+        return result;
+    }
+}  // namespace numericParsingDetail
+
+template<typename X>
+constexpr NumericConversionResult<X>
+    tryStrViewToFloat(std::string_view input)
+{
+    static_assert(
+        std::is_floating_point_v<X>, "requested type is not floating point");
+    if (std::is_constant_evaluated()) {
+        return numericParsingDetail::parseFloatConstexpr<X>(input);
+    }
+    return numericParsingDetail::streamToFloat<X>(input);
+}
+#endif
+
+/** convert the leading part of a string_view to a numerical value without
+throwing
+@param V the string to convert
+@return a NumericConversionResult with the value, the number of characters
+consumed and an error code
+*/
+template<typename X>
+constexpr NumericConversionResult<X> tryNumConv(std::string_view V)
+{
+    if constexpr (std::is_integral_v<X>) {
+        return tryStrViewToInteger<X>(V);
+    } else if constexpr (!std::is_floating_point_v<X>) {
+        auto dres = tryNumConv<double>(V);
+        return {X(dres.value), dres.charactersUsed, dres.ec};
+    } else {
+        return tryStrViewToFloat<X>(V);
+    }
+}
+
+/** convert the leading part of a string to a numerical value with the syntax
+accepted by the strto* family of functions in the "C" locale
+@details leading whitespace and a leading '+' are accepted and floating point
+types also accept hexadecimal values with a "0x" prefix. The result does not
+depend on the current C or C++ locale
+@param V the string to convert
+@return a NumericConversionResult with the value, the number of characters
+consumed and an error code
+*/
+template<typename X>
+NumericConversionResult<X> tryCLocaleNumConv(std::string_view V)
+{
+    std::size_t offset{0};
+    while (offset < V.size() && numericParsingDetail::isCSpace(V[offset])) {
+        ++offset;
+    }
+    if (offset < V.size() && V[offset] == '+') {
+        ++offset;
+        if (offset < V.size() && (V[offset] == '-' || V[offset] == '+')) {
+            return {X{0}, 0, std::errc::invalid_argument};
+        }
+    }
+    auto numberString = V.substr(offset);
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+    if constexpr (std::is_floating_point_v<X>) {
+        const bool negative = !numberString.empty() && numberString[0] == '-';
+        const std::size_t signChars = negative ? 1 : 0;
+        if (numberString.size() > signChars + 2 &&
+            numberString[signChars] == '0' &&
+            (numberString[signChars + 1] == 'x' ||
+             numberString[signChars + 1] == 'X')) {
+            const auto hexString = numberString.substr(signChars + 2);
+            NumericConversionResult<X> result;
+            auto conversionResult = std::from_chars(
+                hexString.data(),
+                hexString.data() + hexString.size(),
+                result.value,
+                std::chars_format::hex);
+            if (conversionResult.ec != std::errc::invalid_argument &&
+                hexString.front() != '-') {
+                result.ec = conversionResult.ec;
+                result.charactersUsed = offset + signChars + 2 +
+                    static_cast<std::size_t>(
+                        conversionResult.ptr - hexString.data());
+                if (negative) {
+                    result.value = -result.value;
+                }
+                return result;
+            }
+        }
+    }
+#endif
+    auto result = tryNumConv<X>(numberString);
+    if (result.ec != std::errc::invalid_argument) {
+        result.charactersUsed += offset;
+    }
+    return result;
+}
+
+/** convert UTF-8 text containing a number to the equivalent ASCII text
+@details a leading byte order mark and leading whitespace are removed, Unicode
+space characters (no-break, figure, thin, narrow no-break and ideographic
+spaces) become ' ', and the minus sign and full-width digits, signs, decimal
+point and exponent characters become their ASCII equivalents. All other
+characters are copied unchanged
+*/
+std::string normalizeNumericText(std::string_view input);
+
+namespace numericParsingDetail {
+    /** a function converting the number at the start of a string*/
+    template<typename X>
+    using Converter = NumericConversionResult<X> (*)(std::string_view);
+
+    template<typename X>
+    NumericConversionResult<X> normalizedConversion(
+        std::string_view V,
+        bool complete,
+        const NumericConversionResult<X>& asciiResult,
+        Converter<X> convert);
+
+    /** convert the leading number in a string with the rules of
+    numeric_conversion
+    @details input containing non-ASCII characters where the number stops is
+    normalized with normalizeNumericText and converted again, so pure ASCII
+    input only pays for a single comparison
+    @param convert the conversion of the ASCII text
+    */
+    template<typename X>
+    constexpr NumericConversionResult<X> leadingNumberConversion(
+        std::string_view V,
+        Converter<X> convert = tryNumConv<X>)
+    {
+        NumericConversionResult<X> result;
+        if (V.empty() || !numCheck[V.front()]) {
+            result.ec = std::errc::invalid_argument;
+        } else {
+            result = convert(V);
+        }
+        if (result ? isNonAscii(V, result.charactersUsed) : hasNonAscii(V)) {
+            return normalizedConversion<X>(V, false, result, convert);
+        }
+        return result;
+    }
+
+    /** convert a complete string with the rules of numeric_conversionComplete
+    @details input containing non-ASCII characters that fails to convert is
+    normalized with normalizeNumericText and converted again
+    @param convert the conversion of the ASCII text
+    */
+    template<typename X>
+    constexpr NumericConversionResult<X> completeNumberConversion(
+        std::string_view V,
+        Converter<X> convert = tryNumConv<X>)
+    {
+        NumericConversionResult<X> result;
+        if (V.empty() || !numCheck[V.front()] || !numCheckEnd[V.back()]) {
+            result.ec = std::errc::invalid_argument;
+        } else {
+            result = convert(V);
+            for (auto rem = result.charactersUsed; result && rem < V.size();
+                 ++rem) {
+                if (!isCSpace(V[rem])) {
+                    result.ec = std::errc::invalid_argument;
+                }
+            }
+        }
+        if (!result && hasNonAscii(V)) {
+            return normalizedConversion<X>(V, true, result, convert);
+        }
+        return result;
+    }
+
+    /** convert the normalized version of a string with non-ASCII characters
+    @return the conversion of the normalized string, or asciiResult if
+    normalization does not produce a valid number*/
+    template<typename X>
+    NumericConversionResult<X> normalizedConversion(
+        std::string_view V,
+        bool complete,
+        const NumericConversionResult<X>& asciiResult,
+        Converter<X> convert)
+    {
+        const auto normalized = normalizeNumericText(V);
+        if (normalized == V) {
+            return asciiResult;
+        }
+        auto result = complete ?
+            completeNumberConversion<X>(normalized, convert) :
+            leadingNumberConversion<X>(normalized, convert);
+        return (result.ec == std::errc::invalid_argument) ? asciiResult :
+                                                            result;
+    }
+}  // namespace numericParsingDetail
+
+/** convert a string to a numerical value without throwing
+@details the leading numerical portion of the string is converted, the
+accepted inputs are the same as numeric_conversion
+@param V the string to convert
+@return the converted value or std::nullopt if the conversion failed or was out
+of range
+*/
+template<typename X>
+constexpr std::optional<X> tryNumericConversion(std::string_view V)
+{
+    auto result = numericParsingDetail::leadingNumberConversion<X>(V);
+    if (!result) {
+        return std::nullopt;
+    }
+    return result.value;
+}
+
+/** convert a complete string to a numerical value without throwing
+@details only trailing whitespace is allowed after the number, the accepted
+inputs are the same as numeric_conversionComplete
+@param V the string to convert
+@return the converted value or std::nullopt if the string is not entirely a
+valid number in range of the requested type
+*/
+template<typename X>
+constexpr std::optional<X> tryNumericConversionComplete(std::string_view V)
+{
+    auto result = numericParsingDetail::completeNumberConversion<X>(V);
+    if (!result) {
+        return std::nullopt;
+    }
+    return result.value;
+}
+
+}  // namespace gmlc::utilities
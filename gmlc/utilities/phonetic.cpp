@@ -0,0 +1,231 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "similarity.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace gmlc::utilities::similarity {
+namespace {
+    /** get the upper case ASCII letters of a word, other characters are
+    dropped*/
+    std::string upperLetters(std::string_view word)
+    {
+        std::string letters;
+        letters.reserve(word.size());
+        for (const char wordChar : word) {
+            if (wordChar >= 'a' && wordChar <= 'z') {
+                letters.push_back(static_cast<char>(wordChar - 'a' + 'A'));
+            } else if (wordChar >= 'A' && wordChar <= 'Z') {
+                letters.push_back(wordChar);
+            }
+        }
+        return letters;
+    }
+
+    /** the Soundex digit of an upper case letter, '0' for vowels and the
+    letters H, W and Y which are not coded*/
+    constexpr char soundexDigit(char letter) noexcept
+    {
+        constexpr std::string_view digits{"01230120022455012623010202"};
+        return digits[static_cast<std::size_t>(letter - 'A')];
+    }
+
+    constexpr bool isVowel(char letter) noexcept
+    {
+        return letter == 'A' || letter == 'E' || letter == 'I' ||
+            letter == 'O' || letter == 'U';
+    }
+
+    constexpr bool isFrontVowel(char letter) noexcept
+    {
+        return letter == 'E' || letter == 'I' || letter == 'Y';
+    }
+}  // namespace
+
+std::string soundex(std::string_view word)
+{
+    const std::string letters = upperLetters(word);
+    if (letters.empty()) {
+        return {};
+    }
+    std::string code(1, letters.front());
+    char previous = soundexDigit(letters.front());
+    for (std::size_t ii = 1; ii < letters.size() && code.size() < 4; ++ii) {
+        const char letter = letters[ii];
+        const char digit = soundexDigit(letter);
+        if (digit != '0' && digit != previous) {
+            code.push_back(digit);
+        }
+        // H and W do not separate letters with the same code, vowels do
+        if (letter != 'H' && letter != 'W') {
+            previous = digit;
+        }
+    }
+    code.resize(4, '0');
+    return code;
+}
+
+std::string metaphone(std::string_view word, std::size_t maxLength)
+{
+    const std::string letters = upperLetters(word);
+    std::string code;
+    if (letters.empty()) {
+        return code;
+    }
+    const std::size_t length = letters.size();
+    auto at = [&letters, length](std::size_t index) {
+        return (index < length) ? letters[index] : '\0';
+    };
+    std::size_t start{0};
+    // initial letter exceptions
+    const std::string_view initial = std::string_view(letters).substr(0, 2);
+    if (initial == "AE" || initial == "GN" || initial == "KN" ||
+        initial == "PN" || initial == "WR") {
+        start = 1;
+    } else if (letters.front() == 'X') {
+        code.push_back('S');
+        start = 1;
+    } else if (initial == "WH") {
+        code.push_back('W');
+        start = 2;
+    }
+    const auto full = [&code, maxLength]() {
+        return maxLength != 0 && code.size() >= maxLength;
+    };
+    for (std::size_t ii = start; ii < length && !full(); ++ii) {
+        const char letter = letters[ii];
+        const char previous = (ii > 0) ? letters[ii - 1] : '\0';
+        const char next = at(ii + 1);
+        // doubled letters are coded once except for C
+        if (letter == previous && letter != 'C') {
+            continue;
+        }
+        switch (letter) {
+            case 'A':
+            case 'E':
+            case 'I':
+            case 'O':
+            case 'U':
+                if (ii == 0) {
+                    code.push_back(letter);
+                }
+                break;
+            case 'B':
+                // silent in a final MB
+                if (!(previous == 'M' && ii + 1 == length)) {
+                    code.push_back('B');
+                }
+                break;
+            case 'C':
+                if (next == 'I' && at(ii + 2) == 'A') {
+                    code.push_back('X');
+                } else if (next == 'H') {
+                    code.push_back((previous == 'S') ? 'K' : 'X');
+                    ++ii;
+                } else if (isFrontVowel(next)) {
+                    // silent in SCI, SCE and SCY
+                    if (previous != 'S') {
+                        code.push_back('S');
+                    }
+                } else {
+                    code.push_back('K');
+                }
+                break;
+            case 'D':
+                if (next == 'G' && isFrontVowel(at(ii + 2))) {
+                    code.push_back('J');
+                    ii += 2;
+                } else {
+                    code.push_back('T');
+                }
+                break;
+            case 'G':
+                if (next == 'H' && ii + 2 < length && !isVowel(at(ii + 2))) {
+                    // silent in GH not at the end or before a vowel
+                    break;
+                }
+                if (next == 'N' &&
+                    (ii + 2 == length ||
+                     (at(ii + 2) == 'E' && at(ii + 3) == 'D' &&
+                      ii + 4 == length))) {
+                    // silent in a final GN or GNED
+                    break;
+                }
+                if (isFrontVowel(next) && previous != 'G') {
+                    code.push_back('J');
+                } else {
+                    code.push_back('K');
+                }
+                break;
+            case 'H':
+                // silent after a vowel with no vowel following and in the
+                // digraphs CH, GH, PH, SH and TH
+                if ((isVowel(previous) && !isVowel(next)) || previous == 'C' ||
+                    previous == 'G' || previous == 'P' || previous == 'S' ||
+                    previous == 'T') {
+                    break;
+                }
+                code.push_back('H');
+                break;
+            case 'K':
+                if (previous != 'C') {
+                    code.push_back('K');
+                }
+                break;
+            case 'P':
+                code.push_back((next == 'H') ? 'F' : 'P');
+                break;
+            case 'Q':
+                code.push_back('K');
+                break;
+            case 'S':
+                if (next == 'H' ||
+                    (next == 'I' && (at(ii + 2) == 'O' || at(ii + 2) == 'A'))) {
+                    code.push_back('X');
+                } else {
+                    code.push_back('S');
+                }
+                break;
+            case 'T':
+                if (next == 'I' && (at(ii + 2) == 'O' || at(ii + 2) == 'A')) {
+                    code.push_back('X');
+                } else if (next == 'H') {
+                    code.push_back('0');
+                } else if (!(next == 'C' && at(ii + 2) == 'H')) {
+                    code.push_back('T');
+                }
+                break;
+            case 'V':
+                code.push_back('F');
+                break;
+            case 'W':
+            case 'Y':
+                if (isVowel(next)) {
+                    code.push_back(letter);
+                }
+                break;
+            case 'X':
+                code.push_back('K');
+                code.push_back('S');
+                break;
+            case 'Z':
+                code.push_back('S');
+                break;
+            default:
+                // F, J, L, M, N and R are coded as themselves
+                code.push_back(letter);
+                break;
+        }
+    }
+    if (maxLength != 0 && code.size() > maxLength) {
+        code.resize(maxLength);
+    }
+    return code;
+}
+}  // namespace gmlc::utilities::similarity
@@ -0,0 +1,712 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define fuzzy string similarity measures for comparing names
+ *  @details comparisons ignore ASCII case unless a case_sensitivity option
+ *  is given, accept strings of any length and use no global state so they
+ *  can be called concurrently
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace similarity {
+    /** number of character classes used by the substitution scores*/
+    constexpr int characterClassCount{28};
+    /** character class of characters other than letters and spaces*/
+    constexpr int otherCharacterClass{26};
+    /** character class of a space, used as a word separator*/
+    constexpr int spaceCharacterClass{27};
+
+    /** score of aligning two characters of the same class*/
+    constexpr float matchScore{1.0F};
+    /** score of aligning two characters of different classes*/
+    constexpr float mismatchScore{-0.4F};
+    /** penalty for skipping a character in an alignment*/
+    constexpr float gapPenalty{0.4F};
+
+    /** select whether letter case is significant in a comparison*/
+    enum class case_sensitivity : bool { insensitive, sensitive };
+
+    /** get the character class of a character
+    @return 0-25 for letters ignoring case, spaceCharacterClass for ' ', and
+    otherCharacterClass for everything else
+    */
+    constexpr int characterClass(char testChar) noexcept
+    {
+        if (testChar >= 'a' && testChar <= 'z') {
+            return testChar - 'a';
+        }
+        if (testChar >= 'A' && testChar <= 'Z') {
+            return testChar - 'A';
+        }
+        return (testChar == ' ') ? spaceCharacterClass : otherCharacterClass;
+    }
+
+    /** scores of aligning each pair of character classes*/
+    using SubstitutionMatrix = std::array<
+        std::array<float, characterClassCount>,
+        characterClassCount>;
+
+    /** generate a substitution matrix with one score for all matching classes
+    and one for all mismatched classes*/
+    constexpr SubstitutionMatrix
+        makeSubstitutionMatrix(float match, float mismatch) noexcept
+    {
+        SubstitutionMatrix matrix{};
+        for (int ii = 0; ii < characterClassCount; ++ii) {
+            for (int jj = 0; jj < characterClassCount; ++jj) {
+                matrix[ii][jj] = (ii == jj) ? match : mismatch;
+            }
+        }
+        return matrix;
+    }
+
+    /** the substitution matrix used unless another one is specified
+    @details user matrices given as template arguments must also be constexpr
+    objects with static storage duration*/
+    inline constexpr SubstitutionMatrix defaultSubstitutionMatrix{
+        makeSubstitutionMatrix(matchScore, mismatchScore)};
+
+    /** get the largest score of aligning a character class with itself
+    @details alignment scores are divided by this to give similarities, so a
+    string aligned with itself has a similarity of 1 for any matrix*/
+    constexpr float largestMatchScore(const SubstitutionMatrix& matrix) noexcept
+    {
+        float best{matrix[0][0]};
+        for (int ii = 1; ii < characterClassCount; ++ii) {
+            best = (std::max)(best, matrix[ii][ii]);
+        }
+        return best;
+    }
+
+    /** get the score of aligning two characters*/
+    template<const SubstitutionMatrix& Matrix = defaultSubstitutionMatrix>
+    constexpr float substitutionScore(char char1, char char2) noexcept
+    {
+        return Matrix[characterClass(char1)][characterClass(char2)];
+    }
+
+    /** check if two characters are equal ignoring the case of ASCII letters*/
+    constexpr bool charIeq(char char1, char char2) noexcept
+    {
+        const auto lower = [](char testChar) {
+            return (testChar >= 'A' && testChar <= 'Z') ?
+                static_cast<char>(testChar - 'A' + 'a') :
+                testChar;
+        };
+        return lower(char1) == lower(char2);
+    }
+
+    /** check if two strings are equal ignoring the case of ASCII letters*/
+    bool strIeq(std::string_view str1, std::string_view str2) noexcept;
+
+    namespace detail {
+        /** number of words in a match table for each block of 64 characters*/
+        constexpr std::size_t matchTableBlockSize{256};
+
+        /** set the bits of the positions of each byte value of a pattern
+        @param table matchTableBlockSize zeroed words for each block of 64
+        pattern characters, indexed by the unsigned value of a byte
+        */
+        void buildMatchTable(
+            std::string_view pattern,
+            case_sensitivity sensitivity,
+            std::uint64_t* table);
+    }  // namespace detail
+
+    /** compute the Levenshtein edit distance between two strings
+    @details uses a bit-parallel algorithm that processes 64 characters of the
+    shorter string per machine word
+    @return the minimum number of single character insertions, deletions and
+    substitutions needed to change one string into the other
+    */
+    std::size_t editDistance(
+        std::string_view str1,
+        std::string_view str2,
+        case_sensitivity sensitivity = case_sensitivity::insensitive);
+
+    /** compute the Levenshtein edit distance if it is at most maxDistance
+    @details the computation stops as soon as the distance is known to be
+    larger than maxDistance which makes rejecting dissimilar strings cheap
+    @return the edit distance, or maxDistance+1 if the distance is larger than
+    maxDistance
+    */
+    std::size_t boundedEditDistance(
+        std::string_view str1,
+        std::string_view str2,
+        std::size_t maxDistance,
+        case_sensitivity sensitivity = case_sensitivity::insensitive);
+
+    /** a string preprocessed for computing the edit distance to many other
+    strings
+    @details the bit masks of the character positions in the pattern are
+    computed once on construction
+    */
+    class EditDistancePattern {
+      public:
+        explicit EditDistancePattern(
+            std::string_view pattern,
+            case_sensitivity sensitivity = case_sensitivity::insensitive);
+        /** compute the edit distance between the pattern and a text*/
+        [[nodiscard]] std::size_t distance(std::string_view text) const;
+        /** compute the edit distance between the pattern and a text if it is
+        at most maxDistance
+        @return the edit distance, or maxDistance+1 if the distance is larger
+        than maxDistance
+        */
+        [[nodiscard]] std::size_t
+            distance(std::string_view text, std::size_t maxDistance) const;
+        /** get the length of the pattern*/
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return patternLength;
+        }
+
+      private:
+        /// bit masks of the positions of each byte value in blocks of 64
+        std::vector<std::uint64_t> matchTable;
+        std::size_t patternLength{0};
+    };
+
+    /** compute the American Soundex code of a word
+    @details characters other than ASCII letters are ignored
+    @return a letter followed by 3 digits, or an empty string if the word has
+    no letters
+    */
+    std::string soundex(std::string_view word);
+
+    /** compute the Metaphone code of a word
+    @details the original rules of Philips (1990) applied to the ASCII letters
+    of the word, '0' codes TH and X codes SH
+    @param word the word to encode
+    @param maxLength the maximum length of the code, 0 for no limit
+    */
+    std::string metaphone(std::string_view word, std::size_t maxLength = 0);
+
+    /** compute the Jaro-Winkler similarity of two strings
+    @details the Winkler adjustment of 0.1 per character is applied for a
+    common prefix of up to 4 characters. Matching characters are found with
+    bit masks of the character positions, 64 positions per machine word
+    @return a value between 0 (no similarity) and 1 (identical)
+    */
+    double jaroWinkler(
+        std::string_view str1,
+        std::string_view str2,
+        case_sensitivity sensitivity = case_sensitivity::insensitive);
+
+    /** a string preprocessed for computing the Jaro-Winkler similarity to
+    many other strings
+    @details the bit masks of the character positions in the pattern are
+    computed once on construction, scoring a list of strings also reuses the
+    working memory between strings
+    */
+    class JaroWinklerPattern {
+      public:
+        explicit JaroWinklerPattern(
+            std::string_view pattern,
+            case_sensitivity sensitivity = case_sensitivity::insensitive);
+        /** compute the similarity of the pattern and a text
+        @details the same as jaroWinkler(pattern, text, sensitivity)*/
+        [[nodiscard]] double similarity(std::string_view text) const;
+        /** compute the similarity of the pattern and each text
+        @param texts the strings to score
+        @param[out] scores the scores, must be the same size as texts
+        @throw std::invalid_argument if the sizes do not match
+        */
+        void similarity(
+            std::span<const std::string_view> texts,
+            std::span<double> scores) const;
+        /** compute the similarity of the pattern and each text*/
+        [[nodiscard]] std::vector<double>
+            similarity(std::span<const std::string_view> texts) const;
+        /** get the length of the pattern*/
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return patternString.size();
+        }
+
+      private:
+        std::string patternString;
+        /// bit masks of the positions of each byte value in blocks of 64
+        std::vector<std::uint64_t> matchTable;
+        case_sensitivity caseSensitivity;
+    };
+
+    namespace detail {
+        /** convert a local alignment score to a similarity
+        @param scale the largestMatchScore of the substitution matrix*/
+        constexpr double localSimilarity(
+            float score,
+            std::size_t length1,
+            std::size_t length2,
+            float scale) noexcept
+        {
+            const std::size_t shortest = (std::min)(length1, length2);
+            if (shortest == 0) {
+                return (length1 == length2) ? 1.0 : 0.0;
+            }
+            if (scale <= 0.0F) {
+                return 0.0;
+            }
+            // mismatch scores above the match scores could pass 1
+            return (std::min)(
+                static_cast<double>(score) /
+                    (static_cast<double>(shortest) *
+                     static_cast<double>(scale)),
+                1.0);
+        }
+    }  // namespace detail
+
+    /** compute the best local alignment score of two strings
+    @details Smith-Waterman alignment with the substitution scores of Matrix
+    and a linear gapPenalty
+    @return the highest scoring local alignment, 0 if nothing matches
+    */
+    template<const SubstitutionMatrix& Matrix = defaultSubstitutionMatrix>
+    float smithWatermanScore(std::string_view str1, std::string_view str2)
+    {
+        if (str1.size() < str2.size()) {
+            std::swap(str1, str2);
+        }
+        // a single row over the shorter string holds the previous row
+        std::vector<float> row(str2.size() + 1, 0.0F);
+        float best{0.0F};
+        for (const char char1 : str1) {
+            float diagonal{0.0F};
+            for (std::size_t jj = 1; jj <= str2.size(); ++jj) {
+                const float score = (std::max)(
+                    {0.0F,
+                     diagonal + substitutionScore<Matrix>(char1, str2[jj - 1]),
+                     row[jj] - gapPenalty,
+                     row[jj - 1] - gapPenalty});
+                diagonal = row[jj];
+                row[jj] = score;
+                best = (std::max)(best, score);
+            }
+        }
+        return best;
+    }
+
+    /** compute a similarity from the best local alignment of two strings
+    @return the smithWatermanScore divided by the length of the shorter string
+    times the largestMatchScore of Matrix, 1 if the shorter string is
+    contained in the longer one
+    */
+    template<const SubstitutionMatrix& Matrix = defaultSubstitutionMatrix>
+    double smithWatermanSimilarity(std::string_view str1, std::string_view str2)
+    {
+        constexpr float scale{largestMatchScore(Matrix)};
+        return detail::localSimilarity(
+            smithWatermanScore<Matrix>(str1, str2),
+            str1.size(),
+            str2.size(),
+            scale);
+    }
+
+    /** a query string preprocessed for computing local alignment scores
+    against many other strings
+    @details stores the query profile, the substitution score of every
+    character class against each position of the query, in the striped layout
+    used by a SIMD implementation of the Smith-Waterman algorithm. Scores are
+    identical to smithWatermanScore
+    */
+    class SmithWatermanProfile {
+      public:
+        explicit SmithWatermanProfile(
+            std::string_view query,
+            const SubstitutionMatrix& matrix = defaultSubstitutionMatrix);
+        /** compute the best local alignment score of the query and a text
+        @details the same as smithWatermanScore(query, text) with the matrix
+        given on construction*/
+        [[nodiscard]] float score(std::string_view text) const;
+        /** compute the best local alignment score of the query and each text
+        @param texts the strings to score
+        @param[out] scores the scores, must be the same size as texts
+        @throw std::invalid_argument if the sizes do not match
+        */
+        void score(
+            std::span<const std::string_view> texts,
+            std::span<float> scores) const;
+        /** compute the best local alignment score of the query and each text*/
+        [[nodiscard]] std::vector<float>
+            score(std::span<const std::string_view> texts) const;
+        /** compute the similarity of the query and a text
+        @details the same as smithWatermanSimilarity(query, text) with the
+        matrix given on construction*/
+        [[nodiscard]] double similarity(std::string_view text) const;
+        /** get the length of the query*/
+        [[nodiscard]] std::size_t size() const noexcept { return queryLength; }
+
+      private:
+        /** compute a score reusing the memory for the alignment columns*/
+        float score(std::string_view text, std::vector<float>& workspace) const;
+
+        /// characterClassCount striped rows of substitution scores
+        std::vector<float> profile;
+        std::size_t queryLength{0};
+        /// the largestMatchScore of the matrix
+        float matchScale{matchScore};
+        /// the number of query positions in each SIMD lane
+        std::size_t segmentCount{0};
+    };
+
+    /** band width that includes every cell of the alignment table*/
+    constexpr std::size_t fullBand{(std::numeric_limits<std::size_t>::max)()};
+
+    namespace detail {
+        /** penalty for characters left over at the start of one string*/
+        constexpr double leadingGapPenalty{1.0};
+        /** penalty for each gap opened beyond the first two gap characters*/
+        constexpr double gapOpenPenalty{3.0};
+
+        /** get the largest substitution score in a matrix, at least 0*/
+        constexpr float largestScore(const SubstitutionMatrix& matrix) noexcept
+        {
+            float best{0.0F};
+            for (const auto& row : matrix) {
+                for (const float score : row) {
+                    best = (std::max)(best, score);
+                }
+            }
+            return best;
+        }
+
+        /** track whether the alignment is inside a gap in one string
+        @details 0 is no gap, 1 is a gap of one character, 2 is a longer gap*/
+        constexpr void extendGap(int& gapState, int& gapCount) noexcept
+        {
+            if (gapState == 1) {
+                ++gapCount;
+                gapState = 2;
+            } else if (gapState == 0) {
+                gapState = 1;
+                ++gapCount;
+            }
+        }
+
+        /** the cells of the alignment table within a band around the diagonal
+        @details cell(ii,jj) is the best alignment of str2[0..ii] with
+        str1[0..jj]. Cells left of the band are unreachable and cells right of
+        the band repeat the last cell of the row, the best score of the row*/
+        class AlignmentTable {
+          public:
+            AlignmentTable(
+                std::size_t rows,
+                std::size_t columns,
+                std::size_t band)
+            {
+                // the band must include both corners of the table
+                const std::size_t longest = (std::max)(rows, columns);
+                const std::size_t width = (std::min)(band, longest);
+                belowDiagonal =
+                    width + ((rows > columns) ? rows - columns : 0);
+                aboveDiagonal =
+                    width + ((columns > rows) ? columns - rows : 0);
+                columnCount = columns;
+                rowWidth =
+                    (std::min)(columns, belowDiagonal + aboveDiagonal + 1);
+                cells.resize(rows * rowWidth);
+            }
+            [[nodiscard]] std::size_t first(std::size_t row) const
+            {
+                return (row > belowDiagonal) ? row - belowDiagonal : 0;
+            }
+            [[nodiscard]] std::size_t last(std::size_t row) const
+            {
+                return (std::min)(columnCount - 1, row + aboveDiagonal);
+            }
+            /** a row of the table with the columns inside the band*/
+            struct Row {
+                float* data;
+                std::size_t first;
+                std::size_t last;
+                [[nodiscard]] float value(std::size_t column) const
+                {
+                    if (column < first) {
+                        return std::numeric_limits<float>::lowest();
+                    }
+                    return data[(std::min)(column, last) - first];
+                }
+                float& at(std::size_t column) { return data[column - first]; }
+            };
+            [[nodiscard]] Row row(std::size_t index)
+            {
+                return {
+                    cells.data() + index * rowWidth, first(index), last(index)};
+            }
+            /** get the value of any cell*/
+            [[nodiscard]] float value(std::size_t row, std::size_t column) const
+            {
+                if (column < first(row)) {
+                    return std::numeric_limits<float>::lowest();
+                }
+                const std::size_t index = (std::min)(column, last(row));
+                return cells[row * rowWidth + index - first(row)];
+            }
+
+          private:
+            std::vector<float> cells;
+            std::size_t belowDiagonal{0};
+            std::size_t aboveDiagonal{0};
+            std::size_t columnCount{0};
+            std::size_t rowWidth{0};
+        };
+
+        /** the alignment similarity with the substitution scores given by
+        pairScore(char1, char2)
+        @param scale the largestMatchScore of the substitution scores
+        @param bestStep the largest substitution score, at least 0*/
+        template<class PairScore>
+        double boundedAlignmentSimilarity(
+            std::string_view str1,
+            std::string_view str2,
+            double minimumSimilarity,
+            std::size_t band,
+            PairScore pairScore,
+            double scale,
+            double bestStep)
+        {
+            if (strIeq(str1, str2)) {
+                return 1.0;
+            }
+            if (str1.empty() || str2.empty()) {
+                return 0.0;
+            }
+            const std::size_t len1 = str1.size();
+            const std::size_t len2 = str2.size();
+            // the alignment is at least as long as the longer string and the
+            // score is at most the best path through the table
+            const double longest = static_cast<double>((std::max)(len1, len2));
+            const bool bounded = minimumSimilarity > 0.0;
+            // scores are divided by the match score so every matrix gives a
+            // similarity of at most 1
+            if (scale <= 0.0) {
+                return 0.0;
+            }
+            const auto cannotReach =
+                [bounded, minimumSimilarity, longest, scale](double bound) {
+                    return bounded &&
+                        (std::max)(bound, 0.0) <
+                        minimumSimilarity * longest * scale;
+                };
+            if (cannotReach(
+                    bestStep * static_cast<double>((std::min)(len1, len2)))) {
+                return 0.0;
+            }
+            AlignmentTable DV(len2, len1, band);
+            auto current = DV.row(0);
+            current.at(0) = pairScore(str1[0], str2[0]);
+            for (std::size_t jj = 1; jj <= current.last; ++jj) {
+                current.at(jj) = (std::max)(
+                    pairScore(str1[jj], str2[0]), current.at(jj - 1));
+            }
+            for (std::size_t ii = 1; ii < len2; ++ii) {
+                auto above = DV.row(ii - 1);
+                const auto twoAbove = DV.row((ii > 1) ? ii - 2 : 0);
+                current = DV.row(ii);
+                std::size_t jj = current.first;
+                float left{std::numeric_limits<float>::lowest()};
+                if (jj == 0) {
+                    left = (std::max)(
+                        pairScore(str1[0], str2[ii]), above.at(0));
+                    current.at(0) = left;
+                    ++jj;
+                }
+                for (; jj <= current.last; ++jj) {
+                    const float diagonal = above.value(jj - 1);
+                    const float up = above.value(jj);
+                    const float cell = (std::max)(
+                        {diagonal + pairScore(str1[jj], str2[ii]), left, up});
+                    // favor a diagonal path through ties
+                    if ((ii > 1) && (jj > 1) && (jj - 1 <= above.last) &&
+                        (up == left) && (up > diagonal) &&
+                        (diagonal == twoAbove.value(jj - 2))) {
+                        above.at(jj - 1) = up;
+                    }
+                    current.at(jj) = cell;
+                    left = cell;
+                }
+                // each remaining row adds at most one aligned pair to the
+                // best path
+                const double rowBound = current.at(current.last) +
+                    bestStep * static_cast<double>(len2 - 1 - ii);
+                if (cannotReach(rowBound)) {
+                    return 0.0;
+                }
+            }
+            /*Run the back trace algorithm and score simultaneously, rest1 and
+            rest2 are the characters of each string not yet aligned*/
+            std::size_t rest1{len1};
+            std::size_t rest2{len2};
+            int alignmentLength{0};
+            int gapCount{0};
+            int gapState1{0};
+            int gapState2{0};
+            double score{0.0};
+            while ((rest1 > 0) || (rest2 > 0)) {
+                ++alignmentLength;
+                if (rest2 == 0) {
+                    gapState2 = 0;
+                    score -= leadingGapPenalty;
+                    if (gapState1 == 0) {
+                        gapCount += 2;
+                        gapState1 = 2;
+                    }
+                    --rest1;
+                    continue;
+                }
+                if (rest1 == 0) {
+                    gapState1 = 0;
+                    score -= leadingGapPenalty;
+                    if (gapState2 == 0) {
+                        gapCount += 2;
+                        gapState2 = 2;
+                    }
+                    --rest2;
+                    continue;
+                }
+                const std::size_t jj = rest1 - 1;
+                const std::size_t ii = rest2 - 1;
+                if (charIeq(str1[jj], str2[ii])) {
+                    score += pairScore(str1[jj], str2[ii]);
+                    --rest1;
+                    --rest2;
+                } else if ((ii > 0) && (jj > 0)) {
+                    const float up = DV.value(ii - 1, jj);
+                    const float diagonal = DV.value(ii - 1, jj - 1);
+                    const float left = DV.value(ii, jj - 1);
+                    if ((up > diagonal) && (up >= left)) {
+                        // skip a character of str2
+                        gapState1 = 0;
+                        score -= gapPenalty;
+                        extendGap(gapState2, gapCount);
+                        --rest2;
+                    } else if ((up > diagonal) || (left > diagonal)) {
+                        // skip a character of str1
+                        gapState2 = 0;
+                        score -= gapPenalty;
+                        extendGap(gapState1, gapCount);
+                        --rest1;
+                    } else {
+                        gapState1 = 0;
+                        gapState2 = 0;
+                        if (charIeq(str1[jj], str2[ii - 1]) &&
+                            charIeq(str1[jj - 1], str2[ii])) {
+                            // transposed characters
+                            score += pairScore(str1[jj], str2[ii - 1]);
+                            rest1 -= 2;
+                            rest2 -= 2;
+                            ++alignmentLength;
+                        } else {
+                            score += pairScore(str1[jj], str2[ii]);
+                            --rest1;
+                            --rest2;
+                        }
+                    }
+                } else if (jj > 0) {
+                    gapState2 = 0;
+                    score -= gapPenalty;
+                    extendGap(gapState1, gapCount);
+                    --rest1;
+                } else if (ii > 0) {
+                    gapState1 = 0;
+                    score -= gapPenalty;
+                    extendGap(gapState2, gapCount);
+                    --rest2;
+                } else {
+                    score += pairScore(str1[jj], str2[ii]);
+                    --rest1;
+                    --rest2;
+                }
+            }
+            if (gapCount > 2) {
+                score -= gapOpenPenalty * (gapCount - 2);
+            }
+            const double similarity = (std::min)(
+                (std::max)(score, 0.0) /
+                    (static_cast<double>(alignmentLength) * scale),
+                1.0);
+            return (similarity < minimumSimilarity) ? 0.0 : similarity;
+        }
+    }  // namespace detail
+
+    /** compute the similarity of two strings from a global alignment
+    @details the alignment is scored per aligned character with a penalty for
+    opening more than one gap, a pair of transposed adjacent characters scores
+    as a single match. The score is divided by the alignment length times the
+    largestMatchScore of the matrix
+    @return a value between 0 (no similarity) and 1 (identical)
+    */
+    double alignmentSimilarity(
+        std::string_view str1,
+        std::string_view str2,
+        const SubstitutionMatrix& matrix);
+
+    /** compute the alignment similarity if it is at least minimumSimilarity
+    @details the alignment table is filled one row at a time and the
+    computation stops as soon as the best row score can no longer reach
+    minimumSimilarity. If a band is given only the cells within band positions
+    of the diagonal are computed, which is an approximation that gives the
+    same result as alignmentSimilarity for strings that align along the
+    diagonal
+    @param minimumSimilarity the smallest similarity of interest
+    @param band the number of cells on either side of the diagonal to compute,
+    the band is widened by the difference in the string lengths
+    @return the similarity, or 0 if it is less than minimumSimilarity
+    */
+    double boundedAlignmentSimilarity(
+        std::string_view str1,
+        std::string_view str2,
+        double minimumSimilarity,
+        std::size_t band,
+        const SubstitutionMatrix& matrix);
+
+    /** compute the alignment similarity using the substitution scores of
+    Matrix if it is at least minimumSimilarity
+    @details the scores are inlined into the alignment loop as constants*/
+    template<const SubstitutionMatrix& Matrix = defaultSubstitutionMatrix>
+    double boundedAlignmentSimilarity(
+        std::string_view str1,
+        std::string_view str2,
+        double minimumSimilarity,
+        std::size_t band = fullBand)
+    {
+        constexpr float scale{largestMatchScore(Matrix)};
+        constexpr float bestStep{detail::largestScore(Matrix)};
+        return detail::boundedAlignmentSimilarity(
+            str1,
+            str2,
+            minimumSimilarity,
+            band,
+            [](char char1, char char2) {
+                return substitutionScore<Matrix>(char1, char2);
+            },
+            scale,
+            bestStep);
+    }
+
+    /** compute the similarity of two strings from a global alignment using the
+    substitution scores of Matrix*/
+    template<const SubstitutionMatrix& Matrix = defaultSubstitutionMatrix>
+    double alignmentSimilarity(std::string_view str1, std::string_view str2)
+    {
+        return boundedAlignmentSimilarity<Matrix>(str1, str2, 0.0);
+    }
+}  // namespace similarity
+}  // namespace gmlc::utilities
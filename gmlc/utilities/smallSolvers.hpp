@@ -0,0 +1,357 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define solvers for small dense linear systems with a compile time
+ *  size, for a single system or for batches of systems stored as a structure
+ *  of arrays
+ *  @details the solvers use LU factorization with partial pivoting, the
+ *  batched version works on blocks of systems with the system index as the
+ *  innermost loop so the compiler vectorizes across the systems, the pivot
+ *  search swaps rows with bit masks instead of branches for the same reason
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace gmlc::utilities {
+/** the outcome of solving a small system*/
+enum class solve_status : std::uint8_t {
+    /// the system was solved
+    ok,
+    /// a pivot was no larger than the precision of the matrix entries, the
+    /// solution is not meaningful
+    singular
+};
+
+/** the solution of a single small system*/
+template<std::size_t N, class X>
+struct SmallSystemSolution {
+    std::array<X, N> values{};  //!< the solution x of Ax=b
+    solve_status status{solve_status::ok};  //!< whether the system is singular
+    /// the 1-norm condition number ||A||*||inv(A)||, infinite if singular
+    X condition{0};
+};
+
+namespace smallSolversDetail {
+    /** a block of W systems with the system index innermost, the columns
+    after the matrix hold the right hand side and, when the condition number
+    is requested, the identity whose solution is the inverse*/
+    template<std::size_t N, std::size_t W, class X, bool Condition>
+    struct SystemBlock {
+        static constexpr std::size_t columns{N + 1 + (Condition ? N : 0)};
+        X rows[N][columns][W];
+        X norm[W];  //!< the 1-norm of each matrix
+        X inversePivot[N][W];
+        X smallestPivot[W];
+        /// the condition numbers, only computed with Condition
+        X condition[Condition ? W : 1];
+    };
+
+    /** factor and solve every system of a block in place, the solutions
+    replace the right hand side columns*/
+    template<std::size_t N, std::size_t W, class X, bool Condition>
+    void solveBlock(SystemBlock<N, W, X, Condition>& block)
+    {
+        constexpr std::size_t columns{
+            SystemBlock<N, W, X, Condition>::columns};
+        using Bits = std::conditional_t<
+            sizeof(X) == sizeof(std::uint64_t),
+            std::uint64_t,
+            std::uint32_t>;
+        auto& rows = block.rows;
+        for (std::size_t w = 0; w < W; ++w) {
+            block.norm[w] = X(0);
+            block.smallestPivot[w] = std::numeric_limits<X>::infinity();
+        }
+        for (std::size_t col = 0; col < N; ++col) {
+            X colSum[W] = {};
+            for (std::size_t row = 0; row < N; ++row) {
+                for (std::size_t w = 0; w < W; ++w) {
+                    colSum[w] += std::abs(rows[row][col][w]);
+                }
+            }
+            for (std::size_t w = 0; w < W; ++w) {
+                block.norm[w] =
+                    (colSum[w] > block.norm[w]) ? colSum[w] : block.norm[w];
+            }
+        }
+
+        for (std::size_t k = 0; k < N; ++k) {
+            // move the largest remaining entry of column k to row k, each
+            // comparison swaps the rows through a bit mask so every lane can
+            // choose a different pivot row without a branch to mispredict
+            for (std::size_t row = k + 1; row < N; ++row) {
+                Bits swap[W];
+                for (std::size_t w = 0; w < W; ++w) {
+                    swap[w] = Bits{0} -
+                        static_cast<Bits>(
+                                  std::abs(rows[row][k][w]) >
+                                  std::abs(rows[k][k][w]));
+                }
+                for (std::size_t col = k; col < columns; ++col) {
+                    for (std::size_t w = 0; w < W; ++w) {
+                        const auto upper = std::bit_cast<Bits>(rows[k][col][w]);
+                        const auto lower =
+                            std::bit_cast<Bits>(rows[row][col][w]);
+                        const Bits change = (upper ^ lower) & swap[w];
+                        rows[k][col][w] = std::bit_cast<X>(upper ^ change);
+                        rows[row][col][w] = std::bit_cast<X>(lower ^ change);
+                    }
+                }
+            }
+            for (std::size_t w = 0; w < W; ++w) {
+                const X pivot = std::abs(rows[k][k][w]);
+                block.smallestPivot[w] = (pivot < block.smallestPivot[w]) ?
+                    pivot :
+                    block.smallestPivot[w];
+                block.inversePivot[k][w] = X(1) / rows[k][k][w];
+            }
+            for (std::size_t row = k + 1; row < N; ++row) {
+                X factor[W];
+                for (std::size_t w = 0; w < W; ++w) {
+                    factor[w] = rows[row][k][w] * block.inversePivot[k][w];
+                }
+                for (std::size_t col = k + 1; col < columns; ++col) {
+                    for (std::size_t w = 0; w < W; ++w) {
+                        rows[row][col][w] -= factor[w] * rows[k][col][w];
+                    }
+                }
+            }
+        }
+
+        // back substitution for every column after the matrix
+        for (std::size_t col = N; col < columns; ++col) {
+            for (std::size_t ii = N; ii-- > 0;) {
+                // accumulate in a local array so the compiler sees that it
+                // does not overlap the solved rows
+                X value[W];
+                for (std::size_t w = 0; w < W; ++w) {
+                    value[w] = rows[ii][col][w];
+                }
+                for (std::size_t jj = ii + 1; jj < N; ++jj) {
+                    for (std::size_t w = 0; w < W; ++w) {
+                        value[w] -= rows[ii][jj][w] * rows[jj][col][w];
+                    }
+                }
+                for (std::size_t w = 0; w < W; ++w) {
+                    rows[ii][col][w] = value[w] * block.inversePivot[ii][w];
+                }
+            }
+        }
+        if constexpr (Condition) {
+            // the columns after the solution hold the inverse
+            X inverseNorm[W] = {};
+            for (std::size_t col = N + 1; col < columns; ++col) {
+                X colSum[W] = {};
+                for (std::size_t row = 0; row < N; ++row) {
+                    for (std::size_t w = 0; w < W; ++w) {
+                        colSum[w] += std::abs(rows[row][col][w]);
+                    }
+                }
+                for (std::size_t w = 0; w < W; ++w) {
+                    inverseNorm[w] = (colSum[w] > inverseNorm[w]) ?
+                        colSum[w] :
+                        inverseNorm[w];
+                }
+            }
+            for (std::size_t w = 0; w < W; ++w) {
+                block.condition[w] = block.norm[w] * inverseNorm[w];
+            }
+        }
+    }
+
+    /** the status of lane w of a solved block*/
+    template<std::size_t N, std::size_t W, class X, bool Condition>
+    solve_status
+        laneStatus(const SystemBlock<N, W, X, Condition>& block, std::size_t w)
+    {
+        // NaN entries fail the comparison and are reported as singular
+        return (block.smallestPivot[w] >
+                std::numeric_limits<X>::epsilon() * block.norm[w]) ?
+            solve_status::ok :
+            solve_status::singular;
+    }
+
+    /** the 1-norm condition number of lane w of a solved block*/
+    template<std::size_t N, std::size_t W, class X>
+    X laneCondition(const SystemBlock<N, W, X, true>& block, std::size_t w)
+    {
+        return (laneStatus(block, w) == solve_status::singular) ?
+            std::numeric_limits<X>::infinity() :
+            block.condition[w];
+    }
+
+    /** copy the values of lanes systems into a block entry and fill the
+    remaining lanes, a full block is a fixed size copy*/
+    template<std::size_t W, class X>
+    void loadLanes(X* lane, const X* source, std::size_t lanes, X fill)
+    {
+        if (lanes == W) {
+            std::copy_n(source, W, lane);
+        } else {
+            std::copy_n(source, lanes, lane);
+            std::fill(lane + lanes, lane + W, fill);
+        }
+    }
+
+    /** the number of systems solved together, two cache lines of each
+    entry*/
+    template<class X>
+    constexpr std::size_t blockWidth{128 / sizeof(X)};
+
+    template<std::size_t N, class X, bool Condition>
+    std::size_t solveBatch(
+        std::span<const X> matrices,
+        std::span<const X> rhs,
+        std::span<X> solutions,
+        std::span<solve_status> status,
+        std::span<X> conditions)
+    {
+        constexpr std::size_t W{blockWidth<X>};
+        const std::size_t count = solutions.size() / N;
+        SystemBlock<N, W, X, Condition> block;
+        std::size_t singular{0};
+        for (std::size_t first = 0; first < count; first += W) {
+            const std::size_t lanes = (std::min)(W, count - first);
+            for (std::size_t row = 0; row < N; ++row) {
+                for (std::size_t col = 0; col < N; ++col) {
+                    const X* source =
+                        matrices.data() + (row * N + col) * count + first;
+                    // unused lanes hold the identity to stay regular
+                    loadLanes<W>(
+                        block.rows[row][col],
+                        source,
+                        lanes,
+                        (row == col) ? X(1) : X(0));
+                }
+                loadLanes<W>(
+                    block.rows[row][N],
+                    rhs.data() + row * count + first,
+                    lanes,
+                    X(0));
+                if constexpr (Condition) {
+                    for (std::size_t col = 0; col < N; ++col) {
+                        for (std::size_t w = 0; w < W; ++w) {
+                            block.rows[row][N + 1 + col][w] =
+                                (row == col) ? X(1) : X(0);
+                        }
+                    }
+                }
+            }
+            solveBlock(block);
+            for (std::size_t row = 0; row < N; ++row) {
+                X* target = solutions.data() + row * count + first;
+                if (lanes == W) {
+                    std::copy_n(block.rows[row][N], W, target);
+                } else {
+                    std::copy_n(block.rows[row][N], lanes, target);
+                }
+            }
+            for (std::size_t w = 0; w < lanes; ++w) {
+                const auto laneResult = laneStatus(block, w);
+                if (laneResult == solve_status::singular) {
+                    ++singular;
+                }
+                if (!status.empty()) {
+                    status[first + w] = laneResult;
+                }
+                if constexpr (Condition) {
+                    conditions[first + w] = laneCondition(block, w);
+                }
+            }
+        }
+        return singular;
+    }
+}  // namespace smallSolversDetail
+
+/** solve Ax=b for a single system of N equations with LU factorization and
+partial pivoting
+@details the generalization of solve2x2 and solve3x3 to any small size, with
+a singularity check and the 1-norm condition number
+@param input the matrix A as an array of rows
+@param vals b in the equation Ax=b
+@return the solution, its status and the condition number of A*/
+template<std::size_t N, class X = double>
+SmallSystemSolution<N, X> solveNxN(
+    const std::array<std::array<X, N>, N>& input,
+    const std::array<X, N>& vals)
+{
+    static_assert(
+        std::is_same_v<X, double> || std::is_same_v<X, float>,
+        "solveNxN requires double or float values");
+    static_assert(N > 0, "solveNxN requires at least one equation");
+    smallSolversDetail::SystemBlock<N, 1, X, true> block;
+    for (std::size_t row = 0; row < N; ++row) {
+        for (std::size_t col = 0; col < N; ++col) {
+            block.rows[row][col][0] = input[row][col];
+            block.rows[row][N + 1 + col][0] = (row == col) ? X(1) : X(0);
+        }
+        block.rows[row][N][0] = vals[row];
+    }
+    smallSolversDetail::solveBlock(block);
+    SmallSystemSolution<N, X> result;
+    for (std::size_t row = 0; row < N; ++row) {
+        result.values[row] = block.rows[row][N][0];
+    }
+    result.status = smallSolversDetail::laneStatus(block, 0);
+    result.condition = smallSolversDetail::laneCondition(block, 0);
+    return result;
+}
+
+/** solve a batch of systems Ax=b of N equations stored as a structure of
+arrays
+@details entry (row, col) of the matrix of system s is
+matrices[(row * N + col) * count + s] and entry row of its right hand side
+and solution is rhs[row * count + s], where count = solutions.size() / N.
+Blocks of systems are factored together with the system index innermost so
+the loops vectorize across the systems
+@param matrices the N*N*count matrix entries
+@param rhs the N*count right hand side entries
+@param[out] solutions the N*count solution entries
+@param[out] status optional, the status of each system
+@param[out] conditions optional, the 1-norm condition number of each
+system, computing it about doubles the work
+@return the number of singular systems
+@throw std::invalid_argument if the sizes of the spans do not match*/
+template<std::size_t N, class X>
+std::size_t solveNxN(
+    std::span<const X> matrices,
+    std::span<const X> rhs,
+    std::span<X> solutions,
+    std::span<solve_status> status = {},
+    std::span<X> conditions = {})
+{
+    static_assert(
+        std::is_same_v<X, double> || std::is_same_v<X, float>,
+        "solveNxN requires double or float values");
+    static_assert(N > 0, "solveNxN requires at least one equation");
+    const std::size_t count = solutions.size() / N;
+    if (solutions.size() != N * count || rhs.size() != N * count ||
+        matrices.size() != N * N * count ||
+        (!status.empty() && status.size() != count) ||
+        (!conditions.empty() && conditions.size() != count)) {
+        throw std::invalid_argument(
+            "the batch spans must hold the same number of systems");
+    }
+    if (conditions.empty()) {
+        return smallSolversDetail::solveBatch<N, X, false>(
+            matrices, rhs, solutions, status, conditions);
+    }
+    return smallSolversDetail::solveBatch<N, X, true>(
+        matrices, rhs, solutions, status, conditions);
+}
+}  // namespace gmlc::utilities
@@ -0,0 +1,302 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define estimators of the median and other quantiles of a stream of
+ *  values that do not keep or reorder the whole stream
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace gmlc::utilities {
+/** the exact median of all the values added so far
+@details the lower half of the values is kept in a max heap and the upper
+half in a min heap so adding a value is O(log n) and reading the median is
+O(1), NaN values must not be added
+@tparam X the type of the values*/
+template<class X>
+class RunningMedian {
+  public:
+    /** add a value*/
+    void add(X value)
+    {
+        if (lower.empty() || value <= lower.top()) {
+            lower.push(value);
+        } else {
+            upper.push(value);
+        }
+        // keep the lower heap equal to or one larger than the upper heap
+        if (lower.size() > upper.size() + 1) {
+            upper.push(lower.top());
+            lower.pop();
+        } else if (upper.size() > lower.size()) {
+            lower.push(upper.top());
+            upper.pop();
+        }
+    }
+    /** get the median of the values added, 0 if there are none*/
+    X median() const
+    {
+        if (lower.empty()) {
+            return X(0);
+        }
+        if (lower.size() > upper.size()) {
+            return lower.top();
+        }
+        return static_cast<X>(0.5 * (lower.top() + upper.top()));
+    }
+    /** get the number of values added*/
+    std::size_t count() const { return lower.size() + upper.size(); }
+    /** remove all the values*/
+    void clear()
+    {
+        lower = decltype(lower){};
+        upper = decltype(upper){};
+    }
+
+  private:
+    std::priority_queue<X> lower;  //!< the lower half, largest on top
+    /// the upper half, smallest on top
+    std::priority_queue<X, std::vector<X>, std::greater<X>> upper;
+};
+
+/** estimate a quantile of a stream in constant memory with the P-squared
+algorithm of Jain and Chlamtac
+@details five markers track the minimum, the quantile, the maximum and the
+two points between them, their heights are adjusted with a piecewise
+parabolic fit as values arrive. The result is exact for up to five values
+and an approximation afterwards
+@tparam X a floating point type*/
+template<class X = double>
+class P2Quantile {
+    static_assert(
+        std::is_floating_point_v<X>,
+        "P2Quantile requires a floating point type");
+
+  public:
+    /** construct an estimator
+    @param quantileProbability the quantile to estimate in [0,1]
+    @throw std::invalid_argument if the probability is outside [0,1]*/
+    explicit P2Quantile(double quantileProbability = 0.5):
+        probability(quantileProbability)
+    {
+        if (!(probability >= 0.0 && probability <= 1.0)) {
+            throw std::invalid_argument(
+                "the quantile probability must be in [0,1]");
+        }
+        increments = {
+            0.0,
+            probability / 2.0,
+            probability,
+            (1.0 + probability) / 2.0,
+            1.0};
+    }
+    /** add a value*/
+    void add(X value)
+    {
+        if (total < markers) {
+            heights[total] = value;
+            ++total;
+            if (total == markers) {
+                std::sort(heights.begin(), heights.end());
+                for (std::size_t ii = 0; ii < markers; ++ii) {
+                    positions[ii] = static_cast<double>(ii);
+                    desired[ii] = 4.0 * increments[ii];
+                }
+            }
+            return;
+        }
+        ++total;
+        std::size_t cell{0};
+        if (value < heights[0]) {
+            heights[0] = value;
+        } else if (value >= heights[markers - 1]) {
+            heights[markers - 1] = value;
+            cell = markers - 2;
+        } else {
+            while (value >= heights[cell + 1]) {
+                ++cell;
+            }
+        }
+        for (std::size_t ii = cell + 1; ii < markers; ++ii) {
+            positions[ii] += 1.0;
+        }
+        for (std::size_t ii = 0; ii < markers; ++ii) {
+            desired[ii] += increments[ii];
+        }
+        for (std::size_t ii = 1; ii + 1 < markers; ++ii) {
+            adjust(ii);
+        }
+    }
+    /** get the estimate of the quantile, 0 if no values were added*/
+    X value() const
+    {
+        if (total >= markers) {
+            return heights[2];
+        }
+        if (total == 0) {
+            return X(0);
+        }
+        // too few values for the markers so compute the quantile directly
+        auto sorted = heights;
+        std::sort(sorted.begin(), sorted.begin() + total);
+        const double position = probability * static_cast<double>(total - 1);
+        const auto rank = static_cast<std::size_t>(position);
+        if (rank + 1 >= total) {
+            return sorted[rank];
+        }
+        return static_cast<X>(
+            sorted[rank] +
+            (position - static_cast<double>(rank)) *
+                (sorted[rank + 1] - sorted[rank]));
+    }
+    /** get the number of values added*/
+    std::uint64_t count() const { return total; }
+    /** get the quantile being estimated*/
+    double quantile() const { return probability; }
+
+  private:
+    static constexpr std::size_t markers{5};
+
+    /** move a middle marker one position toward its desired position if it
+    has drifted at least one position from it*/
+    void adjust(std::size_t ii)
+    {
+        const double drift = desired[ii] - positions[ii];
+        const double step = (drift >= 0.0) ? 1.0 : -1.0;
+        if ((drift < 1.0 || positions[ii + 1] - positions[ii] <= 1.0) &&
+            (drift > -1.0 || positions[ii - 1] - positions[ii] >= -1.0)) {
+            return;
+        }
+        const double below = positions[ii] - positions[ii - 1];
+        const double above = positions[ii + 1] - positions[ii];
+        const double parabolic = heights[ii] +
+            step / (positions[ii + 1] - positions[ii - 1]) *
+                ((below + step) * (heights[ii + 1] - heights[ii]) / above +
+                 (above - step) * (heights[ii] - heights[ii - 1]) / below);
+        if (heights[ii - 1] < parabolic && parabolic < heights[ii + 1]) {
+            heights[ii] = static_cast<X>(parabolic);
+        } else {
+            // the parabola overshoots a neighbor so use a linear step
+            const std::size_t neighbor = (step > 0.0) ? ii + 1 : ii - 1;
+            heights[ii] += static_cast<X>(
+                step * (heights[neighbor] - heights[ii]) /
+                (positions[neighbor] - positions[ii]));
+        }
+        positions[ii] += step;
+    }
+
+    double probability;  //!< the quantile being estimated
+    std::uint64_t total{0};  //!< the number of values added
+    std::array<X, markers> heights{};  //!< the marker heights
+    std::array<double, markers> positions{};  //!< the marker positions
+    std::array<double, markers> desired{};  //!< the desired marker positions
+    /// the change of the desired positions for each value
+    std::array<double, markers> increments{};
+};
+
+/** the exact median of the most recent values of a stream
+@details the window is split into a lower and an upper ordered multiset so
+adding a value and dropping the oldest one are O(log w) for a window of w
+values, the window contents are kept in a ring buffer allocated once. NaN
+values must not be added
+@tparam X the type of the values*/
+template<class X>
+class SlidingWindowMedian {
+  public:
+    /** construct with the number of values in the window
+    @throw std::invalid_argument if the window size is 0*/
+    explicit SlidingWindowMedian(std::size_t windowSize): window(windowSize)
+    {
+        if (windowSize == 0) {
+            throw std::invalid_argument("the window size must be positive");
+        }
+    }
+    /** add a value, dropping the oldest value once the window is full
+    @return the median of the values in the window*/
+    X add(X value)
+    {
+        if (filled == window.size()) {
+            remove(window[next]);
+        } else {
+            ++filled;
+        }
+        window[next] = value;
+        next = (next + 1 == window.size()) ? 0 : next + 1;
+        if (lower.empty() || value <= *lower.rbegin()) {
+            lower.insert(value);
+        } else {
+            upper.insert(value);
+        }
+        rebalance();
+        return median();
+    }
+    /** get the median of the values in the window, 0 if it is empty*/
+    X median() const
+    {
+        if (lower.empty()) {
+            return X(0);
+        }
+        if (lower.size() > upper.size()) {
+            return *lower.rbegin();
+        }
+        return static_cast<X>(0.5 * (*lower.rbegin() + *upper.begin()));
+    }
+    /** get the number of values in the window*/
+    std::size_t size() const { return filled; }
+    /** get the largest number of values in the window*/
+    std::size_t windowSize() const { return window.size(); }
+    /** remove all the values*/
+    void clear()
+    {
+        lower.clear();
+        upper.clear();
+        filled = 0;
+        next = 0;
+    }
+
+  private:
+    void remove(X value)
+    {
+        if (value <= *lower.rbegin()) {
+            lower.erase(lower.find(value));
+        } else {
+            upper.erase(upper.find(value));
+        }
+        rebalance();
+    }
+    /** keep the lower set equal to or one larger than the upper set*/
+    void rebalance()
+    {
+        if (lower.size() > upper.size() + 1) {
+            auto largest = std::prev(lower.end());
+            upper.insert(*largest);
+            lower.erase(largest);
+        } else if (upper.size() > lower.size()) {
+            lower.insert(*upper.begin());
+            upper.erase(upper.begin());
+        }
+    }
+
+    std::vector<X> window;  //!< ring buffer of the values in the window
+    std::size_t filled{0};  //!< the number of values in the window
+    std::size_t next{0};  //!< the ring buffer slot of the next value
+    std::multiset<X> lower;  //!< the lower half of the window
+    std::multiset<X> upper;  //!< the upper half of the window
+};
+}  // namespace gmlc::utilities
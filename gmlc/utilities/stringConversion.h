@@ -20,121 +20,63 @@ All rights reserved. SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "charMapper.h"
+#include "numericParsing.h"
 #include "stringOps.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <vector>
 
 namespace gmlc::utilities {
-extern const CharMapper<bool> numCheck;
-extern const CharMapper<bool> numCheckEnd;
+
+namespace stringConversionDetail {
+    /** convert a string with the semantics of the std::sto* functions but
+    independent of the current locale and without throwing*/
+    template<typename X>
+    NumericConversionResult<X> tryConv(std::string_view V)
+    {
+        if constexpr (std::is_same_v<X, uint32_t>) {
+            // matches the behavior of std::stoul
+            auto result = tryCLocaleNumConv<unsigned long>(V);
+            return {static_cast<X>(result.value),
+                    result.charactersUsed,
+                    result.ec};
+        } else if constexpr (
+            std::is_same_v<X, int> || std::is_same_v<X, int64_t> ||
+            std::is_same_v<X, uint64_t> || std::is_floating_point_v<X>) {
+            return tryCLocaleNumConv<X>(V);
+        } else if constexpr (std::is_integral_v<X>) {
+            auto result = tryCLocaleNumConv<int64_t>(V);
+            return {X(result.value), result.charactersUsed, result.ec};
+        } else {
+            auto result = tryCLocaleNumConv<double>(V);
+            return {X(result.value), result.charactersUsed, result.ec};
+        }
+    }
+}  // namespace stringConversionDetail
 
 // templates for single numerical conversion
 template<typename X>
 inline X numConv(const std::string& V)
 {
-    if constexpr (std::is_integral_v<X>) {
-        return X(numConv<int64_t>(V));
-    } else {
-        return X(numConv<double>(V));
-    }
-}
-
-// template definition for double conversion
-template<>
-inline double numConv(const std::string& V)
-{
-    return std::stod(V);
-}
-
-// template definition for long double conversion
-template<>
-inline long double numConv(const std::string& V)
-{
-    return std::stold(V);
-}
-
-// template definition for integer conversion
-template<>
-inline int numConv(const std::string& V)
-{
-    return std::stoi(V);
-}
-
-// template definition for unsigned long conversion
-template<>
-inline uint32_t numConv(const std::string& V)
-{
-    return std::stoul(V);
-}
-// template definition for unsigned long long conversion
-template<>
-inline uint64_t numConv(const std::string& V)
-{
-    return std::stoull(V);
-}
-
-// template definition for long long conversion
-template<>
-inline int64_t numConv(const std::string& V)
-{
-    return std::stoll(V);
+    auto result = stringConversionDetail::tryConv<X>(V);
+    numericParsingDetail::checkConversionError(result.ec);
+    return result.value;
 }
 
 // template for numeric conversion returning the position
 template<class X>
 inline X numConvComp(const std::string& V, size_t& rem)
 {
-    if constexpr (std::is_integral_v<X>) {
-        return X(numConvComp<int64_t>(V, rem));
-    } else {
-        return X(numConvComp<double>(V, rem));
-    }
-}
-
-template<>
-inline float numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stof(V, &rem);
-}
-
-template<>
-inline double numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stod(V, &rem);
-}
-
-template<>
-inline long double numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stold(V, &rem);
-}
-
-template<>
-inline int numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stoi(V, &rem);
-}
-
-template<>
-inline uint32_t numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stoul(V, &rem);
-}
-
-template<>
-inline uint64_t numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stoull(V, &rem);
-}
-
-template<>
-inline int64_t numConvComp(const std::string& V, size_t& rem)
-{
-    return std::stoll(V, &rem);
+    auto result = stringConversionDetail::tryConv<X>(V);
+    numericParsingDetail::checkConversionError(result.ec);
+    rem = result.charactersUsed;
+    return result.value;
 }
 
 /** check if the first character of the string is a valid numerical value*/
@@ -149,18 +91,22 @@ inline bool nonNumericFirstOrLastCharacter(const std::string& V)
     return ((V.empty()) || (!numCheck[V[0]]) || (!numCheckEnd[V.back()]));
 }
 
+/** convert the leading number in a string
+@details UTF-8 text with byte order marks, Unicode spaces or full-width
+characters is normalized with normalizeNumericText
+@return the converted value or defValue if the string is not a number
+@throw std::out_of_range if the value is out of range of X
+*/
 template<typename X>
 X numeric_conversion(const std::string& V, const X defValue)
 {
-    if (nonNumericFirstCharacter(V)) {
-        return defValue;
-    }
-    try {
-        return numConv<X>(V);
-    }
-    catch (const std::invalid_argument&) {
-        return defValue;
+    const auto result = numericParsingDetail::leadingNumberConversion<X>(
+        V, stringConversionDetail::tryConv<X>);
+    if (result.ec == std::errc::result_out_of_range) {
+        throw(std::out_of_range(
+            "conversion type does not support the string conversion"));
     }
+    return (result.ec == std::errc{}) ? result.value : defValue;
 }
 
 /** do a numeric conversion of the complete string
@@ -168,24 +114,13 @@ X numeric_conversion(const std::string& V, const X defValue)
 template<typename X>
 X numeric_conversionComplete(const std::string& V, const X defValue)
 {
-    if (nonNumericFirstOrLastCharacter(V)) {
-        return defValue;
-    }
-    try {
-        size_t rem;
-        X res = numConvComp<X>(V, rem);
-        while (rem < V.length()) {
-            if (!(isspace(V[rem]))) {
-                res = defValue;
-                break;
-            }
-            ++rem;
-        }
-        return res;
-    }
-    catch (const std::invalid_argument&) {
-        return defValue;
+    const auto result = numericParsingDetail::completeNumberConversion<X>(
+        V, stringConversionDetail::tryConv<X>);
+    if (result.ec == std::errc::result_out_of_range) {
+        throw(std::out_of_range(
+            "conversion type does not support the string conversion"));
     }
+    return (result.ec == std::errc{}) ? result.value : defValue;
 }
 
 /** @brief  convert a string into a vector of double precision numbers
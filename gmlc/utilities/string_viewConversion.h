@@ -12,112 +12,46 @@
 #pragma once
 
 #include "charMapper.h"
+#include "numericParsing.h"
 #include "string_viewOps.h"
 
-#include <charconv>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <vector>
 
 namespace gmlc::utilities {
-extern const CharMapper<bool> numCheck;
-extern const CharMapper<bool> numCheckEnd;
 
 template<typename X>
-X strViewToInteger(std::string_view input, size_t* charactersUsed = nullptr)
+constexpr X
+    strViewToInteger(std::string_view input, size_t* charactersUsed = nullptr)
 {
-    static_assert(std::is_integral_v<X>, "requested type is not integral");
-    X val{0};
+    auto result = tryStrViewToInteger<X>(input);
     if (charactersUsed != nullptr) {
-        *charactersUsed = 0;
+        *charactersUsed = result.charactersUsed;
     }
-    std::size_t additionalChars{0};
-    if (input.size() > 1) {
-        while (input[0] == ' ') {
-            input.remove_prefix(1);
-            ++additionalChars;
-            if (input.empty()) {
-                if (charactersUsed != nullptr) {
-                    *charactersUsed = additionalChars;
-                }
-                return val;
-            }
-        }
-        if (input.front() == '0') {
-            if (input[1] != 'X' && input[1] != 'x') {
-                while (input[0] == '0') {
-                    input.remove_prefix(1);
-                    ++additionalChars;
-                    if (input.empty()) {
-                        if (charactersUsed != nullptr) {
-                            *charactersUsed = additionalChars;
-                        }
-                        return val;
-                    }
-                }
-            }
-        }
-    }
-    auto conversionResult =
-        std::from_chars(input.data(), input.data() + input.size(), val);
-    if (conversionResult.ec == std::errc()) {
-        if (charactersUsed != nullptr) {
-            *charactersUsed =
-                (conversionResult.ptr - input.data()) + additionalChars;
-        }
-        return val;
-    }
-    if (conversionResult.ec == std::errc::result_out_of_range) {
-        if (charactersUsed != nullptr) {
-            *charactersUsed = (conversionResult.ptr - input.data());
-        }
-        throw(std::out_of_range(
-            "conversion type does not support the string conversion"));
-    }
-    if constexpr (std::is_unsigned_v<X>) {
-        if (input.size() > 1 && input.front() == '-') {
-            auto signedVal =
-                strViewToInteger<std::make_signed_t<X>>(input, charactersUsed);
-            // additional chars must be 0 in this case otherwise it should have
-            // been an error
-            return static_cast<X>(signedVal);
-        }
-    }
-    throw(std::invalid_argument("unable to convert string"));
+    numericParsingDetail::checkConversionError(result.ec);
+    return result.value;
 }
 
-#ifdef __cpp_lib_to_chars
+/** convert a string_view to a floating point value
+@details the conversion is independent of the current locale
+*/
 template<typename X>
-X strViewToFloat(std::string_view input, size_t* charactersUsed = nullptr)
+constexpr X
+    strViewToFloat(std::string_view input, size_t* charactersUsed = nullptr)
 {
-    static_assert(
-        std::is_floating_point_v<X>, "requested type is not floating point");
-    X val{0};
+    auto result = tryStrViewToFloat<X>(input);
     if (charactersUsed != nullptr) {
-        *charactersUsed = 0;
-    }
-    auto conversionResult =
-        std::from_chars(input.data(), input.data() + input.size(), val);
-    if (conversionResult.ec == std::errc{}) {
-        if (charactersUsed != nullptr) {
-            *charactersUsed = (conversionResult.ptr - input.data());
-        }
-        return val;
-    }
-    if (conversionResult.ec == std::errc::result_out_of_range) {
-        if (charactersUsed != nullptr) {
-            *charactersUsed = (conversionResult.ptr - input.data());
-        }
-        throw(std::out_of_range(
-            "conversion type does not support the string conversion"));
+        *charactersUsed = result.charactersUsed;
     }
-    throw(std::invalid_argument("unable to convert string"));
+    numericParsingDetail::checkConversionError(result.ec);
+    return result.value;
 }
-#endif
 
 // templates for single numerical conversion
 template<typename X>
-inline X numConv(std::string_view V)
+constexpr X numConv(std::string_view V)
 {
     if constexpr (std::is_integral_v<X>) {
         return strViewToInteger<X>(V);
@@ -128,39 +62,27 @@ inline X numConv(std::string_view V)
 
 // template definition for double conversion
 template<>
-inline double numConv(std::string_view V)
+constexpr double numConv(std::string_view V)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<double>(V);
-#else
-    return std::stod(std::string(V.data(), V.length()));
-#endif
 }
 
 template<>
-inline float numConv(std::string_view V)
+constexpr float numConv(std::string_view V)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<float>(V);
-#else
-    return std::stof(std::string(V.data(), V.length()));
-#endif
 }
 
 // template definition for long double conversion
 template<>
-inline long double numConv(std::string_view V)
+constexpr long double numConv(std::string_view V)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<long double>(V);
-#else
-    return std::stold(std::string(V.data(), V.length()));
-#endif
 }
 
 // template for numeric conversion returning the position
 template<class X>
-inline X numConvComp(std::string_view V, size_t& charactersUsed)
+constexpr X numConvComp(std::string_view V, size_t& charactersUsed)
 {
     if constexpr (std::is_integral_v<X>) {
         return strViewToInteger<X>(V, &charactersUsed);
@@ -170,84 +92,63 @@ inline X numConvComp(std::string_view V, size_t& charactersUsed)
 }
 
 template<>
-inline float numConvComp(std::string_view V, size_t& charactersUsed)
+constexpr float numConvComp(std::string_view V, size_t& charactersUsed)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<float>(V, &charactersUsed);
-#else
-    return std::stof(std::string(V.data(), V.length()), &charactersUsed);
-#endif
 }
 
 template<>
-inline double numConvComp(std::string_view V, size_t& charactersUsed)
+constexpr double numConvComp(std::string_view V, size_t& charactersUsed)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<double>(V, &charactersUsed);
-#else
-    return std::stod(std::string(V.data(), V.length()), &charactersUsed);
-#endif
 }
 
 template<>
-inline long double numConvComp(std::string_view V, size_t& charactersUsed)
+constexpr long double numConvComp(std::string_view V, size_t& charactersUsed)
 {
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
     return strViewToFloat<long double>(V, &charactersUsed);
-#else
-    return std::stold(std::string(V.data(), V.length()), &charactersUsed);
-#endif
 }
 
 /** check if the first character of the string is a valid numerical value*/
-inline bool nonNumericFirstCharacter(std::string_view V)
+constexpr bool nonNumericFirstCharacter(std::string_view V)
 {
     return (V.empty()) || (!numCheck[V[0]]);
 }
 
 /** check if the first character of the string is a valid numerical value*/
-inline bool nonNumericFirstOrLastCharacter(std::string_view V)
+constexpr bool nonNumericFirstOrLastCharacter(std::string_view V)
 {
     return (V.empty()) || (!numCheck[V[0]]) || (!numCheckEnd[V.back()]);
 }
 
+/** convert the leading number in a string
+@details UTF-8 text with byte order marks, Unicode spaces or full-width
+characters is normalized with normalizeNumericText
+@return the converted value or defValue if the string is not a number
+@throw std::out_of_range if the value is out of range of X
+*/
 template<typename X>
-X numeric_conversion(std::string_view V, const X defValue)
+constexpr X numeric_conversion(std::string_view V, const X defValue)
 {
-    if (nonNumericFirstCharacter(V)) {
-        return defValue;
-    }
-    try {
-        return numConv<X>(V);
-    }
-    catch (const std::invalid_argument&) {
-        return defValue;
+    auto result = numericParsingDetail::leadingNumberConversion<X>(V);
+    if (result.ec == std::errc::result_out_of_range) {
+        throw(std::out_of_range(
+            "conversion type does not support the string conversion"));
     }
+    return (result.ec == std::errc{}) ? result.value : defValue;
 }
 
 /** do a numeric conversion of the complete string
  */
 template<typename X>
-X numeric_conversionComplete(std::string_view V, const X defValue)
+constexpr X numeric_conversionComplete(std::string_view V, const X defValue)
 {
-    if (nonNumericFirstOrLastCharacter(V)) {
-        return defValue;
-    }
-    try {
-        size_t rem;
-        X res = numConvComp<X>(V, rem);
-        while (rem < V.length()) {
-            if (!(isspace(V[rem]))) {
-                res = defValue;
-                break;
-            }
-            ++rem;
-        }
-        return res;
-    }
-    catch (const std::invalid_argument&) {
-        return defValue;
+    auto result = numericParsingDetail::completeNumberConversion<X>(V);
+    if (result.ec == std::errc::result_out_of_range) {
+        throw(std::out_of_range(
+            "conversion type does not support the string conversion"));
     }
+    return (result.ec == std::errc{}) ? result.value : defValue;
 }
 
 /** @brief  convert a string into a vector of double precision numbers
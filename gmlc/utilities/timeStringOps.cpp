@@ -7,56 +7,45 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #include "timeStringOps.hpp"
 
-#include "stringOps.h"
-#include "string_viewConversion.h"
 #include "string_viewOps.h"
 #include "timeRepresentation.hpp"
+#include "unitParsing.hpp"
 
-#include <cstddef>
-#include <map>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 namespace gmlc::utilities {
 namespace {
-    const std::map<std::string_view, time_units>& timeUnitStrings()
-    {
-        static const std::map<std::string_view, time_units> time_unitstrings{
-            {"ps", time_units::ps},
-            {"ns", time_units::ns},
-            {"us", time_units::us},
-            {"ms", time_units::ms},
-            {"s", time_units::s},
-            {"sec", time_units::sec},
-            // don't want empty string to error default is sec
-            {"", time_units::sec},
-            {"seconds", time_units::sec},
-            {"second", time_units::sec},
-            {"min", time_units::minutes},
-            {"minute", time_units::minutes},
-            {"minutes", time_units::minutes},
-            {"hr", time_units::hr},
-            {"hour", time_units::hr},
-            {"hours", time_units::hr},
-            {"day", time_units::day},
-            {"week", time_units::week},
-            {"wk", time_units::week}};
-        return time_unitstrings;
-    }
+    constexpr auto timeUnitTable = makeUnitTable<time_units>({
+        {"ps", time_units::ps},
+        {"ns", time_units::ns},
+        {"us", time_units::us},
+        {"ms", time_units::ms},
+        {"s", time_units::s},
+        {"sec", time_units::sec},
+        // don't want empty string to error default is sec
+        {"", time_units::sec},
+        {"seconds", time_units::sec},
+        {"second", time_units::sec},
+        {"min", time_units::minutes},
+        {"minute", time_units::minutes},
+        {"minutes", time_units::minutes},
+        {"hr", time_units::hr},
+        {"hour", time_units::hr},
+        {"hours", time_units::hr},
+        {"day", time_units::day},
+        {"week", time_units::week},
+        {"wk", time_units::week},
+    });
 }  // namespace
 
 time_units timeUnitsFromString(std::string_view unitString)
 {
-    auto fnd = timeUnitStrings().find(unitString);
-    if (fnd != timeUnitStrings().end()) {
-        return fnd->second;
-    }
-    const std::string lcUstring =
-        convertToLowerCase(string_viewOps::trim(unitString));
-    fnd = timeUnitStrings().find(lcUstring);
-    if (fnd != timeUnitStrings().end()) {
-        return fnd->second;
+    auto units = timeUnitTable.find(string_viewOps::trim(unitString));
+    if (units) {
+        return *units;
     }
     throw(std::invalid_argument(
         std::string("unit ") + std::string(unitString) + " not recognized"));
@@ -64,13 +53,17 @@ time_units timeUnitsFromString(std::string_view unitString)
 
 double getTimeValue(std::string_view timeString, time_units defUnit)
 {
-    size_t pos;
-    const double val = numConvComp<double>(timeString, pos);
-    if (pos >= timeString.size()) {
-        return val * toSecondMultiplier(defUnit);
+    auto result =
+        tryNumberWithUnits<double>(timeString, timeUnitTable, defUnit);
+    if (!result) {
+        if (!result.unitString.empty()) {
+            throw(std::invalid_argument(
+                std::string("unit ") + std::string(result.unitString) +
+                " not recognized"));
+        }
+        numericParsingDetail::checkConversionError(result.ec);
     }
-    auto units = string_viewOps::trim(timeString.substr(pos));
-    return val * toSecondMultiplier(timeUnitsFromString(units));
+    return result.value * toSecondMultiplier(result.units);
 }
 
 }  // namespace gmlc::utilities
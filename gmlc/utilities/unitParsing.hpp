@@ -0,0 +1,210 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define single pass parsing of numbers followed by a unit string
+ */
+#pragma once
+
+#include "numericParsing.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace gmlc::utilities {
+namespace unitParsingDetail {
+    constexpr char lowerChar(char testChar) noexcept
+    {
+        return (testChar >= 'A' && testChar <= 'Z') ?
+            static_cast<char>(testChar - 'A' + 'a') :
+            testChar;
+    }
+
+    /** FNV-1a hash of the lower case version of a string*/
+    constexpr std::uint32_t caseInsensitiveHash(std::string_view str) noexcept
+    {
+        std::uint32_t hash{2166136261U};
+        for (auto strChar : str) {
+            hash ^= static_cast<unsigned char>(lowerChar(strChar));
+            hash *= 16777619U;
+        }
+        return hash;
+    }
+
+    constexpr bool caseInsensitiveEqual(
+        std::string_view str1,
+        std::string_view str2) noexcept
+    {
+        if (str1.size() != str2.size()) {
+            return false;
+        }
+        for (std::size_t ii = 0; ii < str1.size(); ++ii) {
+            if (lowerChar(str1[ii]) != lowerChar(str2[ii])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** get a power of 2 table size with a load factor of at most 0.5*/
+    constexpr std::size_t hashTableSize(std::size_t entries) noexcept
+    {
+        std::size_t size{8};
+        while (size < 2 * entries) {
+            size *= 2;
+        }
+        return size;
+    }
+}  // namespace unitParsingDetail
+
+/** a constant table mapping unit strings to unit values
+@details the table is built at compile time as an open addressing hash table
+on a case insensitive hash so lookups do not allocate. An exact match is
+preferred over a case insensitive one so units differing only in case (like
+"MW" and "mW") can coexist
+@tparam U the unit type, usually an enumeration
+@tparam N the number of unit strings in the table
+*/
+template<typename U, std::size_t N>
+class UnitTable {
+  private:
+    static constexpr std::size_t tableSize{
+        unitParsingDetail::hashTableSize(N)};
+    std::array<std::pair<std::string_view, U>, N> entries{};
+    /// index+1 into entries for each hash slot, 0 is an empty slot
+    std::array<std::size_t, tableSize> slots{};
+
+  public:
+    /** construct from an array of unit string and unit pairs*/
+    constexpr explicit UnitTable(
+        const std::array<std::pair<std::string_view, U>, N>& unitEntries) :
+        entries(unitEntries)
+    {
+        for (std::size_t ii = 0; ii < N; ++ii) {
+            auto slot = unitParsingDetail::caseInsensitiveHash(
+                            entries[ii].first) &
+                (tableSize - 1);
+            while (slots[slot] != 0) {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+            slots[slot] = ii + 1;
+        }
+    }
+    /** find the unit corresponding to a unit string
+    @param unitString the string to look up, it is not trimmed
+    @return the unit or std::nullopt if the string is not in the table
+    */
+    [[nodiscard]] constexpr std::optional<U>
+        find(std::string_view unitString) const noexcept
+    {
+        auto slot = unitParsingDetail::caseInsensitiveHash(unitString) &
+            (tableSize - 1);
+        std::optional<U> caseInsensitiveMatch;
+        while (slots[slot] != 0) {
+            const auto& entry = entries[slots[slot] - 1];
+            if (entry.first == unitString) {
+                return entry.second;
+            }
+            if (!caseInsensitiveMatch &&
+                unitParsingDetail::caseInsensitiveEqual(
+                    entry.first, unitString)) {
+                caseInsensitiveMatch = entry.second;
+            }
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        return caseInsensitiveMatch;
+    }
+    /** get the number of unit strings in the table*/
+    static constexpr std::size_t size() noexcept { return N; }
+};
+
+/** generate a UnitTable from a list of unit string and unit pairs
+@code
+constexpr auto powerUnits = makeUnitTable<powerUnit>(
+    {{"W", powerUnit::W}, {"kW", powerUnit::kW}, {"MW", powerUnit::MW}});
+@endcode
+*/
+template<typename U, std::size_t N>
+constexpr UnitTable<U, N>
+    makeUnitTable(const std::pair<std::string_view, U> (&unitEntries)[N])
+{
+    std::array<std::pair<std::string_view, U>, N> entries{};
+    for (std::size_t ii = 0; ii < N; ++ii) {
+        entries[ii] = unitEntries[ii];
+    }
+    return UnitTable<U, N>(entries);
+}
+
+/** the result of converting a number with units*/
+template<typename X, typename U>
+struct UnitConversionResult {
+    X value{0};  //!< the numerical value
+    U units{};  //!< the units of the value
+    /// the unit text found after the number (empty if none was given)
+    std::string_view unitString;
+    /// the error code, if the number was valid but the units were not
+    /// unitString is not empty
+    std::errc ec{};
+    /** check if the conversion was successful*/
+    constexpr explicit operator bool() const noexcept
+    {
+        return ec == std::errc{};
+    }
+};
+
+/** convert a string containing a number optionally followed by units
+@details the string is processed in a single pass with no allocation, for
+example "15 min" or "2.5ms". Whitespace is allowed before the number, between
+the number and the units, and after the units
+@param input the string to convert
+@param unitTable the table of valid unit strings
+@param defUnits the units to use if no units are given
+@return a UnitConversionResult containing the value and units
+*/
+template<typename X, typename U, std::size_t N>
+UnitConversionResult<X, U> tryNumberWithUnits(
+    std::string_view input,
+    const UnitTable<U, N>& unitTable,
+    U defUnits)
+{
+    UnitConversionResult<X, U> result;
+    const auto numberResult = tryCLocaleNumConv<X>(input);
+    if (!numberResult) {
+        result.ec = numberResult.ec;
+        return result;
+    }
+    result.value = numberResult.value;
+    auto unitStart = numberResult.charactersUsed;
+    while (unitStart < input.size() &&
+           numericParsingDetail::isCSpace(input[unitStart])) {
+        ++unitStart;
+    }
+    auto unitEnd = input.size();
+    while (unitEnd > unitStart &&
+           numericParsingDetail::isCSpace(input[unitEnd - 1])) {
+        --unitEnd;
+    }
+    if (unitEnd == unitStart) {
+        result.units = defUnits;
+        return result;
+    }
+    result.unitString = input.substr(unitStart, unitEnd - unitStart);
+    auto units = unitTable.find(result.unitString);
+    if (units) {
+        result.units = *units;
+    } else {
+        result.ec = std::errc::invalid_argument;
+    }
+    return result;
+}
+
+}  // namespace gmlc::utilities
@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "vectorCompare.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/* The tolerance kernels are compiled with GCC on x86-64 Linux for AVX-512,
+AVX2 and the baseline SSE2 with the best version selected when the program is
+loaded, the comparison templates are inlined into each version*/
+
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC diagnostic ignored "-Wpsabi"
+#    if defined(__x86_64__) && defined(__linux__)
+#        define GMLC_UTILITIES_COMPARE_KERNEL                                  \
+            __attribute__((target_clones("avx512f", "avx2", "default")))
+#    endif
+#    define GMLC_UTILITIES_FLATTEN [[gnu::flatten]]
+#else
+#    define GMLC_UTILITIES_FLATTEN
+#endif
+#ifndef GMLC_UTILITIES_COMPARE_KERNEL
+#    define GMLC_UTILITIES_COMPARE_KERNEL
+#endif
+
+namespace gmlc::utilities::vectorCompareDetail {
+GMLC_UTILITIES_COMPARE_KERNEL GMLC_UTILITIES_FLATTEN
+std::size_t toleranceKernel(
+    const double* reference,
+    const double* values,
+    std::size_t count,
+    double absoluteTolerance,
+    double relativeTolerance,
+    bool ignoreZeroReference,
+    double* diffs,
+    double* relative,
+    std::uint64_t* failed)
+{
+    return toleranceChunk(
+        reference,
+        values,
+        count,
+        absoluteTolerance,
+        relativeTolerance,
+        ignoreZeroReference,
+        diffs,
+        relative,
+        failed);
+}
+GMLC_UTILITIES_COMPARE_KERNEL GMLC_UTILITIES_FLATTEN
+std::size_t toleranceKernel(
+    const float* reference,
+    const float* values,
+    std::size_t count,
+    float absoluteTolerance,
+    float relativeTolerance,
+    bool ignoreZeroReference,
+    float* diffs,
+    float* relative,
+    std::uint64_t* failed)
+{
+    return toleranceChunk(
+        reference,
+        values,
+        count,
+        absoluteTolerance,
+        relativeTolerance,
+        ignoreZeroReference,
+        diffs,
+        relative,
+        failed);
+}
+}  // namespace gmlc::utilities::vectorCompareDetail
@@ -0,0 +1,339 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define a tolerance based comparison of two sets of values that
+ *  reports the violations, the largest differences and the distribution of
+ *  the error magnitudes in a single pass
+ */
+#pragma once
+
+#include "vectorOps.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace gmlc::utilities {
+/** the tolerances and reporting limits of compareWithTolerance*/
+struct ToleranceOptions {
+    /// a difference no larger than this is within tolerance
+    double absoluteTolerance{0.0};
+    /// a difference no larger than this fraction of |reference| is within
+    /// tolerance
+    double relativeTolerance{0.0};
+    /// the number of mismatches whose index and values are recorded
+    std::size_t recordedMismatches{10};
+    /// pairs whose reference value is 0 are not checked, as countDiffsIfValid
+    bool ignoreZeroReference{false};
+    /// collect a histogram of the decade of each absolute difference
+    bool histogram{true};
+    /// the decade of the smallest histogram bin above the bin of exact
+    /// matches, 10^minimumExponent <= |diff| < 10^(minimumExponent+1)
+    int minimumExponent{-16};
+    /// differences of at least 10^maximumExponent share the last bin
+    int maximumExponent{4};
+};
+
+/** a pair of values outside of tolerance*/
+template<class X>
+struct Mismatch {
+    std::size_t index{0};  //!< the index of the pair
+    X reference{0};  //!< the reference value
+    X value{0};  //!< the value compared against it
+};
+
+/** the result of compareWithTolerance
+@details the histogram has maximumExponent - minimumExponent + 3 bins, bin 0
+counts exact matches, bin 1 differences below 10^minimumExponent, bin k + 2
+differences in [10^(minimumExponent + k), 10^(minimumExponent + k + 1)) and
+the last bin differences of at least 10^maximumExponent and NaN*/
+template<class X>
+struct ComparisonReport {
+    std::size_t compared{0};  //!< the number of pairs compared
+    /// the number of pairs outside of tolerance plus the number of values
+    /// present in only one of the inputs
+    std::size_t mismatches{0};
+    X sumAbsDiff{0};  //!< the sum of the absolute differences
+    X maxAbsDiff{0};  //!< the largest absolute difference
+    std::size_t maxAbsDiffIndex{0};  //!< the first index of maxAbsDiff
+    /// the largest difference relative to a nonzero |reference|
+    X maxRelDiff{0};
+    std::size_t maxRelDiffIndex{0};  //!< the first index of maxRelDiff
+    /// the first mismatches in index order
+    std::vector<Mismatch<X>> firstMismatches;
+    std::vector<std::size_t> histogram;  //!< the counts of the error decades
+    /** true if every pair is within tolerance and the sizes match*/
+    bool passed() const { return mismatches == 0; }
+};
+
+namespace vectorCompareDetail {
+    /** the number of pairs whose differences are computed at once, small
+    enough for the differences to stay in the L1 cache*/
+    constexpr std::size_t chunkSize{1024};
+
+    template<class X>
+    X sumOf(std::span<const X> values)
+    {
+        if constexpr (vectorOpsDetail::has_reduction_kernel_v<X>) {
+            return vectorOpsDetail::sumKernel(values.data(), values.size());
+        } else {
+            return vectorOpsDetail::sum<X>(values);
+        }
+    }
+
+    template<class X>
+    X maxOf(std::span<const X> values)
+    {
+        if constexpr (vectorOpsDetail::has_reduction_kernel_v<X>) {
+            return vectorOpsDetail::absMaxKernel(values.data(), values.size());
+        } else {
+            return vectorOpsDetail::absMax<X>(values);
+        }
+    }
+
+    /** compute the absolute and relative differences of count pairs and set
+    a bit in failed for each pair outside of tolerance
+    @details the loops have no branches, with masked vector instructions
+    they vectorize completely
+    @return the number of pairs outside of tolerance*/
+    template<class X>
+    std::size_t toleranceChunk(
+        const X* reference,
+        const X* values,
+        std::size_t count,
+        X absoluteTolerance,
+        X relativeTolerance,
+        bool ignoreZeroReference,
+        X* diffs,
+        X* relative,
+        std::uint64_t* failed)
+    {
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            const X diff = std::abs(reference[ii] - values[ii]);
+            const X scale = std::abs(reference[ii]);
+            // divide unconditionally so the selection needs no branch
+            const X ratio = diff / scale;
+            diffs[ii] = diff;
+            relative[ii] = (scale > X(0)) ? ratio : X(0);
+        }
+        std::size_t failures{0};
+        for (std::size_t first = 0; first < count; first += 64) {
+            const std::size_t bits = (std::min)(std::size_t{64}, count - first);
+            std::uint64_t mask{0};
+            for (std::size_t bit = 0; bit < bits; ++bit) {
+                const std::size_t ii = first + bit;
+                const X diff = diffs[ii];
+                const bool within = (diff <= absoluteTolerance) |
+                    (diff <= relativeTolerance * std::abs(reference[ii])) |
+                    (ignoreZeroReference & (reference[ii] == X(0)));
+                mask |= static_cast<std::uint64_t>(!within) << bit;
+            }
+            failed[first / 64] = mask;
+            failures += static_cast<std::size_t>(std::popcount(mask));
+        }
+        return failures;
+    }
+
+    /* toleranceChunk compiled for several instruction sets in
+    vectorCompare.cpp*/
+    std::size_t toleranceKernel(
+        const double* reference,
+        const double* values,
+        std::size_t count,
+        double absoluteTolerance,
+        double relativeTolerance,
+        bool ignoreZeroReference,
+        double* diffs,
+        double* relative,
+        std::uint64_t* failed);
+    std::size_t toleranceKernel(
+        const float* reference,
+        const float* values,
+        std::size_t count,
+        float absoluteTolerance,
+        float relativeTolerance,
+        bool ignoreZeroReference,
+        float* diffs,
+        float* relative,
+        std::uint64_t* failed);
+
+    template<class X>
+    std::size_t tolerance(
+        const X* reference,
+        const X* values,
+        std::size_t count,
+        X absoluteTolerance,
+        X relativeTolerance,
+        bool ignoreZeroReference,
+        X* diffs,
+        X* relative,
+        std::uint64_t* failed)
+    {
+        if constexpr (std::is_same_v<X, double> || std::is_same_v<X, float>) {
+            return toleranceKernel(
+                reference,
+                values,
+                count,
+                absoluteTolerance,
+                relativeTolerance,
+                ignoreZeroReference,
+                diffs,
+                relative,
+                failed);
+        } else {
+            return toleranceChunk(
+                reference,
+                values,
+                count,
+                absoluteTolerance,
+                relativeTolerance,
+                ignoreZeroReference,
+                diffs,
+                relative,
+                failed);
+        }
+    }
+
+    /** the first index holding a value, the caller knows it is present*/
+    template<class X>
+    std::size_t indexOf(std::span<const X> values, X value)
+    {
+        return static_cast<std::size_t>(
+            std::find(values.begin(), values.end(), value) - values.begin());
+    }
+}  // namespace vectorCompareDetail
+
+/** compare values against reference values within tolerances
+@details a pair fails if its absolute difference is larger than both the
+absolute tolerance and the relative tolerance times |reference|, a NaN in
+either value fails. The values are processed in chunks, the differences of a
+chunk are computed once into a buffer by a vectorized kernel along with a
+mask of the failures, then the sums and maximums are vectorized reductions
+over that buffer, so the sum may differ from compareVec in the last bits
+@param reference the expected values
+@param values the values to check
+@param options the tolerances and reporting limits
+@return a report of the comparison*/
+template<class X>
+ComparisonReport<X> compareWithTolerance(
+    std::span<const X> reference,
+    std::span<const X> values,
+    const ToleranceOptions& options = {})
+{
+    static_assert(
+        std::is_floating_point_v<X>,
+        "compareWithTolerance requires a floating point type");
+    const std::size_t cnt = (std::min)(reference.size(), values.size());
+    ComparisonReport<X> report;
+    report.compared = cnt;
+    report.mismatches = (std::max)(reference.size(), values.size()) - cnt;
+
+    const int decades = (std::max)(
+        options.maximumExponent - options.minimumExponent, 0);
+    std::vector<X> edges;
+    if (options.histogram) {
+        report.histogram.assign(static_cast<std::size_t>(decades) + 3, 0);
+        edges.reserve(static_cast<std::size_t>(decades) + 1);
+        for (int exponent = options.minimumExponent;
+             exponent <= options.minimumExponent + decades;
+             ++exponent) {
+            edges.push_back(
+                static_cast<X>(std::pow(10.0, static_cast<double>(exponent))));
+        }
+    }
+    const auto absTolerance = static_cast<X>(options.absoluteTolerance);
+    const auto relTolerance = static_cast<X>(options.relativeTolerance);
+
+    std::array<X, vectorCompareDetail::chunkSize> diffs;
+    std::array<X, vectorCompareDetail::chunkSize> relative;
+    std::array<std::uint64_t, vectorCompareDetail::chunkSize / 64> failed;
+    for (std::size_t start = 0; start < cnt;
+         start += vectorCompareDetail::chunkSize) {
+        const std::size_t length =
+            (std::min)(vectorCompareDetail::chunkSize, cnt - start);
+        const X* ref = reference.data() + start;
+        const X* val = values.data() + start;
+        const std::size_t chunkFailures = vectorCompareDetail::tolerance(
+            ref,
+            val,
+            length,
+            absTolerance,
+            relTolerance,
+            options.ignoreZeroReference,
+            diffs.data(),
+            relative.data(),
+            failed.data());
+        const std::span<const X> chunkDiffs(diffs.data(), length);
+        const std::span<const X> chunkRelative(relative.data(), length);
+        report.sumAbsDiff += vectorCompareDetail::sumOf(chunkDiffs);
+
+        const X chunkMax = vectorCompareDetail::maxOf(chunkDiffs);
+        if (chunkMax > report.maxAbsDiff) {
+            report.maxAbsDiff = chunkMax;
+            report.maxAbsDiffIndex =
+                start + vectorCompareDetail::indexOf(chunkDiffs, chunkMax);
+        }
+        const X chunkRelMax = vectorCompareDetail::maxOf(chunkRelative);
+        if (chunkRelMax > report.maxRelDiff) {
+            report.maxRelDiff = chunkRelMax;
+            report.maxRelDiffIndex = start +
+                vectorCompareDetail::indexOf(chunkRelative, chunkRelMax);
+        }
+
+        report.mismatches += chunkFailures;
+        for (std::size_t word = 0; chunkFailures > 0 &&
+             report.firstMismatches.size() < options.recordedMismatches &&
+             word * 64 < length;
+             ++word) {
+            std::uint64_t mask = failed[word];
+            while (mask != 0 &&
+                   report.firstMismatches.size() < options.recordedMismatches) {
+                const std::size_t ii = word * 64 +
+                    static_cast<std::size_t>(std::countr_zero(mask));
+                report.firstMismatches.push_back(
+                    {start + ii, ref[ii], val[ii]});
+                mask &= mask - 1;
+            }
+        }
+
+        if (options.histogram) {
+            for (const X diff : chunkDiffs) {
+                std::size_t bin{0};
+                if (diff < edges.front()) {
+                    bin = (diff > X(0)) ? 1 : 0;
+                } else {
+                    // NaN compares false with every edge so lands last
+                    const auto edge =
+                        std::upper_bound(edges.begin(), edges.end(), diff);
+                    bin = static_cast<std::size_t>(edge - edges.begin()) + 1;
+                }
+                ++report.histogram[bin];
+            }
+        }
+    }
+    return report;
+}
+
+/** compare the values of a vector against reference values within
+tolerances*/
+template<class X>
+ComparisonReport<X> compareWithTolerance(
+    const std::vector<X>& reference,
+    const std::vector<X>& values,
+    const ToleranceOptions& options = {})
+{
+    return compareWithTolerance(
+        std::span<const X>(reference), std::span<const X>(values), options);
+}
+}  // namespace gmlc::utilities
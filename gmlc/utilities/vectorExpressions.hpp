@@ -0,0 +1,244 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/** @file
+ *  @brief define lazily evaluated element wise expressions over spans so a
+ *  chain of operations runs as a single loop without temporary vectors
+ *  @details wrap the inputs with expression() and combine them with + - * /
+ *  and scalars, then write the result with evaluate, for example
+ *  evaluate(out, expression(a) * expression(b) + 2.0 * expression(c))
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace gmlc::utilities {
+namespace vectorExpressionDetail {
+    /** the size of an expression made only of scalars*/
+    constexpr std::size_t unbounded{
+        (std::numeric_limits<std::size_t>::max)()};
+}  // namespace vectorExpressionDetail
+
+/** an expression reading the values of a span*/
+template<class X>
+class SpanExpression {
+  public:
+    using value_type = X;
+    explicit SpanExpression(std::span<const X> data): values(data) {}
+    X operator[](std::size_t index) const { return values[index]; }
+    std::size_t size() const { return values.size(); }
+
+  private:
+    std::span<const X> values;
+};
+
+/** an expression with the same value at every index*/
+template<class X>
+class ScalarExpression {
+  public:
+    using value_type = X;
+    explicit ScalarExpression(X scalar): value(scalar) {}
+    X operator[](std::size_t /*index*/) const { return value; }
+    std::size_t size() const { return vectorExpressionDetail::unbounded; }
+
+  private:
+    X value;
+};
+
+/** an expression applying an operation to the values of another*/
+template<class Op, class E>
+class UnaryExpression {
+  public:
+    using value_type = typename E::value_type;
+    explicit UnaryExpression(E operand): inner(operand) {}
+    value_type operator[](std::size_t index) const
+    {
+        return static_cast<value_type>(Op()(inner[index]));
+    }
+    std::size_t size() const { return inner.size(); }
+
+  private:
+    E inner;
+};
+
+/** an expression combining the values of two others at the same index, the
+size is the smaller of the two*/
+template<class Op, class L, class R>
+class BinaryExpression {
+  public:
+    using value_type = std::common_type_t<
+        typename L::value_type,
+        typename R::value_type>;
+    BinaryExpression(L leftOperand, R rightOperand):
+        left(leftOperand), right(rightOperand)
+    {
+    }
+    value_type operator[](std::size_t index) const
+    {
+        return static_cast<value_type>(Op()(
+            static_cast<value_type>(left[index]),
+            static_cast<value_type>(right[index])));
+    }
+    std::size_t size() const { return (std::min)(left.size(), right.size()); }
+
+  private:
+    L left;
+    R right;
+};
+
+/** trait for the types that can take part in an expression*/
+template<class T>
+struct is_vector_expression: std::false_type {};
+template<class X>
+struct is_vector_expression<SpanExpression<X>>: std::true_type {};
+template<class X>
+struct is_vector_expression<ScalarExpression<X>>: std::true_type {};
+template<class Op, class E>
+struct is_vector_expression<UnaryExpression<Op, E>>: std::true_type {};
+template<class Op, class L, class R>
+struct is_vector_expression<BinaryExpression<Op, L, R>>: std::true_type {};
+
+template<class T>
+constexpr bool is_vector_expression_v = is_vector_expression<T>::value;
+
+namespace vectorExpressionDetail {
+    /** wrap an arithmetic scalar as an expression of the value type of the
+    other operand so float expressions are not promoted to double*/
+    template<class E, class S>
+    auto scalar(S value)
+    {
+        return ScalarExpression<typename E::value_type>(
+            static_cast<typename E::value_type>(value));
+    }
+
+    /** true if L and R are two expressions, or one expression and one
+    arithmetic scalar*/
+    template<class L, class R>
+    constexpr bool operands_v =
+        (is_vector_expression_v<L> && is_vector_expression_v<R>) ||
+        (is_vector_expression_v<L> && std::is_arithmetic_v<R>) ||
+        (std::is_arithmetic_v<L> && is_vector_expression_v<R>);
+
+    template<class Op, class L, class R>
+    auto combine(const L& left, const R& right)
+    {
+        if constexpr (!is_vector_expression_v<L>) {
+            const auto leftScalar = scalar<R>(left);
+            return BinaryExpression<Op, decltype(leftScalar), R>(
+                leftScalar, right);
+        } else if constexpr (!is_vector_expression_v<R>) {
+            const auto rightScalar = scalar<L>(right);
+            return BinaryExpression<Op, L, decltype(rightScalar)>(
+                left, rightScalar);
+        } else {
+            return BinaryExpression<Op, L, R>(left, right);
+        }
+    }
+}  // namespace vectorExpressionDetail
+
+/** make an expression from a span, the span must outlive the expression*/
+template<class X>
+SpanExpression<X> expression(std::span<const X> values)
+{
+    return SpanExpression<X>(values);
+}
+
+/** make an expression from a vector, the vector must outlive the
+expression*/
+template<class X>
+SpanExpression<X> expression(const std::vector<X>& values)
+{
+    return SpanExpression<X>(std::span<const X>(values));
+}
+
+/** a temporary vector would be destroyed before the expression is used*/
+template<class X>
+SpanExpression<X> expression(std::vector<X>&& values) = delete;
+
+/* the arithmetic operators combine two expressions or an expression and a
+scalar into a new expression without computing anything*/
+template<
+    class L,
+    class R,
+    typename = std::enable_if_t<vectorExpressionDetail::operands_v<L, R>>>
+auto operator+(const L& left, const R& right)
+{
+    return vectorExpressionDetail::combine<std::plus<>>(left, right);
+}
+
+template<
+    class L,
+    class R,
+    typename = std::enable_if_t<vectorExpressionDetail::operands_v<L, R>>>
+auto operator-(const L& left, const R& right)
+{
+    return vectorExpressionDetail::combine<std::minus<>>(left, right);
+}
+
+template<
+    class L,
+    class R,
+    typename = std::enable_if_t<vectorExpressionDetail::operands_v<L, R>>>
+auto operator*(const L& left, const R& right)
+{
+    return vectorExpressionDetail::combine<std::multiplies<>>(left, right);
+}
+
+template<
+    class L,
+    class R,
+    typename = std::enable_if_t<vectorExpressionDetail::operands_v<L, R>>>
+auto operator/(const L& left, const R& right)
+{
+    return vectorExpressionDetail::combine<std::divides<>>(left, right);
+}
+
+template<class E, typename = std::enable_if_t<is_vector_expression_v<E>>>
+auto operator-(const E& operand)
+{
+    return UnaryExpression<std::negate<>, E>(operand);
+}
+
+/** evaluate an expression into a span in a single loop
+@details the output may be one of the inputs of the expression since each
+element only depends on the inputs at the same index
+@param[out] out the location of the result, the first min(out.size(),
+expr.size()) elements are written
+@param expr the expression to evaluate
+@return the number of elements written*/
+template<class X, class E>
+std::size_t evaluate(std::span<X> out, const E& expr)
+{
+    static_assert(
+        is_vector_expression_v<E>, "evaluate requires a vector expression");
+    const std::size_t cnt = (std::min)(out.size(), expr.size());
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        out[ii] = static_cast<X>(expr[ii]);
+    }
+    return cnt;
+}
+
+/** evaluate an expression into a vector resized to the expression size
+@details if out is also an input of the expression it must already have the
+size of the expression*/
+template<class X, class E>
+std::size_t evaluate(std::vector<X>& out, const E& expr)
+{
+    static_assert(
+        is_vector_expression_v<E>, "evaluate requires a vector expression");
+    if (expr.size() != vectorExpressionDetail::unbounded) {
+        out.resize(expr.size());
+    }
+    return evaluate(std::span<X>(out), expr);
+}
+}  // namespace gmlc::utilities
@@ -10,11 +10,16 @@
  * LLNS Copyright End
  */
 
+#include "interpolation.hpp"
 #include "vectorOps.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
+#include <future>
+#include <span>
+#include <thread>
 #include <vector>
 
 namespace gmlc::utilities {
@@ -70,45 +75,70 @@ std::array<double, 3> solve3x3(
     return output;
 }
 
-// Linear Interpolation function
 std::vector<double> interpolateLinear(
     const std::vector<double>& timeIn,
     const std::vector<double>& valIn,
     const std::vector<double>& timeOut)
 {
-    const size_t minSize = (std::min)(valIn.size(), timeIn.size());
-    std::vector<double> out(timeOut.size(), 0);
-    size_t indexOut = 0;
-    size_t indexIn = 0;
-    while (timeOut[indexOut] <= timeIn[0]) {
-        out[indexOut] = valIn[0] -
-            (((valIn[1] - valIn[0]) / (timeIn[1] - timeIn[0])) *
-             (timeIn[0] - timeOut[indexOut]));
-        ++indexOut;
-    }
-    while (indexOut < timeOut.size()) {
-        while (timeIn[indexIn + 1] < timeOut[indexOut]) {
-            ++indexIn;
-            if (indexIn + 1 == minSize) {
-                goto breakLoop;  // break out of a double loop
+    return interpolateLinear(
+        std::span<const double>(timeIn),
+        std::span<const double>(valIn),
+        std::span<const double>(timeOut));
+}
+
+// Linear Interpolation function
+std::vector<double> interpolateLinear(
+    std::span<const double> timeIn,
+    std::span<const double> valIn,
+    std::span<const double> timeOut)
+{
+    return Interpolator<double>(timeIn, valIn, interpolation_method::linear)
+        .evaluate(timeOut);
+}
+
+namespace vectorOpsDetail {
+    void parallelForBlocks(
+        std::size_t count,
+        const ParallelOptions& options,
+        const std::function<void(std::size_t, std::size_t, std::size_t)>&
+            operation)
+    {
+        const std::size_t blockSize =
+            (std::max)(options.blockSize, std::size_t{1});
+        const std::size_t blocks = (count + blockSize - 1) / blockSize;
+        if (blocks == 0) {
+            return;
+        }
+        std::size_t threads = (options.threads == 0) ?
+            std::thread::hardware_concurrency() :
+            options.threads;
+        threads = std::clamp<std::size_t>(threads, 1, blocks);
+        // each thread runs a contiguous range of blocks
+        const auto runBlocks = [&](std::size_t first, std::size_t last) {
+            for (std::size_t block = first; block < last; ++block) {
+                const std::size_t start = block * blockSize;
+                operation(
+                    block, start, (std::min)(blockSize, count - start));
             }
+        };
+        const std::size_t baseBlocks = blocks / threads;
+        const std::size_t extra = blocks % threads;
+        const std::size_t firstBlocks = baseBlocks + ((extra > 0) ? 1U : 0U);
+        std::vector<std::future<void>> workers;
+        workers.reserve(threads - 1);
+        std::size_t first{firstBlocks};
+        for (std::size_t thread = 1; thread < threads; ++thread) {
+            const std::size_t length =
+                baseBlocks + ((thread < extra) ? 1U : 0U);
+            workers.push_back(std::async(
+                std::launch::async, runBlocks, first, first + length));
+            first += length;
+        }
+        // the calling thread runs the first range
+        runBlocks(0, firstBlocks);
+        for (auto& worker : workers) {
+            worker.get();
         }
-        out[indexOut] = valIn[indexIn] +
-            (((valIn[indexIn + 1] - valIn[indexIn]) /
-              (timeIn[indexIn + 1] - timeIn[indexIn])) *
-             (timeOut[indexOut] - timeIn[indexIn]));
-        // out[jj] = std::fma((valIn[kk + 1] - valIn[kk]) / (timeIn[kk + 1]
-        // - timeIn[kk]), (timeOut[jj] - timeIn[kk]), valIn[kk]);
-        ++indexOut;
-    }
-breakLoop:
-    while (indexOut < timeOut.size()) {
-        out[indexOut] = valIn[minSize - 1] +
-            (((valIn[minSize - 1] - valIn[minSize - 2]) /
-              (timeIn[minSize - 1] - timeIn[minSize - 2])) *
-             (timeOut[indexOut] - timeIn[minSize - 1]));
-        ++indexOut;
     }
-    return out;
-}
+}  // namespace vectorOpsDetail
 }  // namespace gmlc::utilities
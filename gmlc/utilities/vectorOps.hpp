@@ -17,9 +17,14 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <numeric>
+#include <span>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -58,16 +63,29 @@ std::array<double, 3> solve3x3(
     const std::array<double, 3>& vals);
 
 /** perform a linear interpolation
-@param[in] timeIn a vector of time values
+@details values outside the range of timeIn are extrapolated from the end
+segments, see Interpolator in interpolation.hpp for other schemes and for
+evaluating the same table repeatedly
+@param[in] timeIn a vector of time values, non decreasing, a repeated time is
+a step change and takes the value before the step
 @param[in] valIn the values of the known vector
-@param[in] timeOut  the desired times in the output vector
+@param[in] timeOut  the desired times in the output vector, in any order
 @return the computed values corresponding to timeOut
+@throw std::invalid_argument if timeIn or valIn is empty or timeIn decreases
 */
 std::vector<double> interpolateLinear(
     const std::vector<double>& timeIn,
     const std::vector<double>& valIn,
     const std::vector<double>& timeOut);
 
+/** perform a linear interpolation on spans of data
+@details the span overload of interpolateLinear
+*/
+std::vector<double> interpolateLinear(
+    std::span<const double> timeIn,
+    std::span<const double> valIn,
+    std::span<const double> timeOut);
+
 /** force a value to be between two limits
 @details if val is between the two limits it returns val if it is not it returns
 the appropriate limit requires that the < operator be defined on the type
@@ -121,6 +139,402 @@ constexpr M signn(M x)
     return ((x < M(0)) ? M(-1) : ((x != M(0)) ? M(1) : M(0)));
 }
 
+/** a non-owning view of every stride-th element of contiguous memory
+@details lets the reductions run without copying on a column of a row major
+matrix or on one member of an array of structures
+@tparam X the type of the elements, const for a read only view
+*/
+template<class X>
+class StridedSpan {
+  public:
+    using element_type = X;
+    using value_type = std::remove_cv_t<X>;
+    using size_type = std::size_t;
+
+    constexpr StridedSpan() noexcept = default;
+    /** construct a view
+    @param data pointer to the first element
+    @param length the number of elements in the view
+    @param stride the distance between consecutive elements of the view
+    */
+    constexpr StridedSpan(
+        X* data,
+        size_type length,
+        size_type stride) noexcept :
+        first(data),
+        count(length), step(stride)
+    {
+    }
+    /** view a span with a stride of 1*/
+    constexpr StridedSpan(std::span<X> values) noexcept :
+        first(values.data()), count(values.size())
+    {
+    }
+    /** convert a mutable view into a read only view*/
+    template<class Y>
+        requires std::is_same_v<X, const Y>
+    constexpr StridedSpan(const StridedSpan<Y>& view) noexcept :
+        first(view.data()),
+        count(view.size()), step(view.stride())
+    {
+    }
+
+    constexpr X& operator[](size_type index) const noexcept
+    {
+        return first[index * step];
+    }
+    [[nodiscard]] constexpr X* data() const noexcept { return first; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return count; }
+    [[nodiscard]] constexpr size_type stride() const noexcept { return step; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
+
+  private:
+    X* first{nullptr};
+    size_type count{0};
+    size_type step{1};
+};
+
+namespace vectorOpsDetail {
+    /* the reductions are written against any view with size() and
+    operator[] so spans and strided spans share them*/
+    template<class X, class View>
+    X sum(const View& a)
+    {
+        X total(0);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            total += a[ii];
+        }
+        return total;
+    }
+
+    template<class X, class View>
+    X absSum(const View& a)
+    {
+        X total(0);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            total += std::abs(a[ii]);
+        }
+        return total;
+    }
+
+    template<class X, class View>
+    X absMax(const View& a)
+    {
+        X largest(0);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            const X absA = std::abs(a[ii]);
+            if (largest < absA) {
+                largest = absA;
+            }
+        }
+        return largest;
+    }
+
+    /** find the first element whose transformed value is preferred over all
+    others, NaN values are skipped and (0,-1) is returned if no value is left*/
+    template<class X, class View, class Transform, class Compare>
+    std::pair<X, int>
+        bestLoc(const View& a, Transform transform, Compare better)
+    {
+        X best(0);
+        int loc{-1};
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            const X value = transform(a[ii]);
+            if constexpr (std::is_floating_point_v<X>) {
+                if (std::isnan(value)) {
+                    continue;
+                }
+            }
+            if (loc < 0 || better(value, best)) {
+                best = value;
+                loc = static_cast<int>(ii);
+            }
+        }
+        return {best, loc};
+    }
+
+    template<class X, class View>
+    X product(const View& a)
+    {
+        X total(1);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            total *= a[ii];
+        }
+        return total;
+    }
+
+    template<class X, class View>
+    X rms(const View& a)
+    {
+        X total(0);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            total += a[ii] * a[ii];
+        }
+        return static_cast<X>(std::sqrt(total));
+    }
+
+    template<class X, class View>
+    X mean(const View& a)
+    {
+        X total = sum<X>(a);
+        if (a.size() > 0) {
+            total /= static_cast<X>(a.size());
+        }
+        return total;
+    }
+
+    template<class X, class View>
+    X stdev(const View& a)
+    {
+        if (a.size() == 0) {
+            return X(0);
+        }
+        const X mv = mean<X>(a);
+        X total(0);
+        for (std::size_t ii = 0; ii < a.size(); ++ii) {
+            total += (a[ii] - mv) * (a[ii] - mv);
+        }
+        return static_cast<X>(std::sqrt(total / static_cast<X>(a.size())));
+    }
+
+    template<class X>
+    auto absValue(X value)
+    {
+        return std::abs(value);
+    }
+    template<class X>
+    X identity(X value)
+    {
+        return value;
+    }
+}  // namespace vectorOpsDetail
+
+/** the evaluation orders allowed for a floating point reduction*/
+enum class reduction_order : std::uint8_t {
+    /// combine the values in order, identical to a scalar loop
+    sequential,
+    /// allow independent partial results to be combined in any order so the
+    /// reduction vectorizes, the result may differ in the last bits
+    reassociate
+};
+
+/** the comparisons of a value against a threshold used by the vecFind
+operations*/
+enum class comparison_op : std::uint8_t {
+    equal,
+    not_equal,
+    less,
+    less_equal,
+    greater,
+    greater_equal
+};
+
+/** options for splitting a vector operation across threads*/
+struct ParallelOptions {
+    /// the number of threads to use, 0 for the hardware concurrency
+    unsigned int threads{0};
+    /// the number of elements in each block of work, reductions combine the
+    /// block results in order so they depend on the block size but not on
+    /// the number of threads
+    std::size_t blockSize{std::size_t{1} << 16U};
+};
+
+namespace vectorOpsDetail {
+    /** run an operation on consecutive blocks of count elements split across
+    threads
+    @details operation is called with the block index, the first element of
+    the block and its length, the blocks run by a thread are contiguous and
+    an exception from any of them is rethrown to the caller*/
+    void parallelForBlocks(
+        std::size_t count,
+        const ParallelOptions& options,
+        const std::function<void(std::size_t, std::size_t, std::size_t)>&
+            operation);
+
+    /** compute a value for every block in parallel and sum them in order*/
+    template<class X, class Function>
+    X parallelBlockSum(
+        std::size_t count,
+        const ParallelOptions& options,
+        Function blockValue)
+    {
+        const std::size_t blockSize =
+            (std::max)(options.blockSize, std::size_t{1});
+        std::vector<X> partials((count + blockSize - 1) / blockSize, X(0));
+        parallelForBlocks(
+            count,
+            options,
+            [&](std::size_t block, std::size_t start, std::size_t length) {
+                partials[block] = blockValue(start, length);
+            });
+        X total(0);
+        for (const auto& partial : partials) {
+            total += partial;
+        }
+        return total;
+    }
+}  // namespace vectorOpsDetail
+
+namespace vectorOpsDetail {
+    /* vectorized kernels defined in vectorReductions.cpp, dispatched at run
+    time to the best instruction set available*/
+    double sumKernel(const double* data, std::size_t count);
+    float sumKernel(const float* data, std::size_t count);
+    std::int64_t sumKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t sumKernel(const std::int32_t* data, std::size_t count);
+    double absSumKernel(const double* data, std::size_t count);
+    float absSumKernel(const float* data, std::size_t count);
+    std::int64_t absSumKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t absSumKernel(const std::int32_t* data, std::size_t count);
+    double sumSquaresKernel(const double* data, std::size_t count);
+    float sumSquaresKernel(const float* data, std::size_t count);
+    std::int64_t sumSquaresKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t sumSquaresKernel(const std::int32_t* data, std::size_t count);
+    double productKernel(const double* data, std::size_t count);
+    float productKernel(const float* data, std::size_t count);
+    std::int64_t productKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t productKernel(const std::int32_t* data, std::size_t count);
+    double absMaxKernel(const double* data, std::size_t count);
+    float absMaxKernel(const float* data, std::size_t count);
+    std::int64_t absMaxKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t absMaxKernel(const std::int32_t* data, std::size_t count);
+    double absMinKernel(const double* data, std::size_t count);
+    float absMinKernel(const float* data, std::size_t count);
+    std::int64_t absMinKernel(const std::int64_t* data, std::size_t count);
+    std::int32_t absMinKernel(const std::int32_t* data, std::size_t count);
+
+    /** the partial statistics of a run of values, m2 is the sum of squared
+    deviations from the mean and absMaxIndex is relative to the run*/
+    template<class X>
+    struct SummaryState {
+        std::size_t count{0};
+        X sum{0};
+        X mean{0};
+        X m2{0};
+        X sumSquares{0};
+        X min{0};
+        X max{0};
+        X absMax{0};
+        std::size_t absMaxIndex{0};
+    };
+
+    /** merge the statistics of a run that follows the state into the state
+    @details the mean and m2 are combined with the pairwise update of Chan et
+    al. so long runs do not lose precision*/
+    template<class X>
+    void mergeSummary(SummaryState<X>& state, const SummaryState<X>& other)
+    {
+        if (other.count == 0) {
+            return;
+        }
+        if (state.count == 0) {
+            state = other;
+            return;
+        }
+        const std::size_t total = state.count + other.count;
+        const X delta = other.mean - state.mean;
+        const X weight =
+            static_cast<X>(other.count) / static_cast<X>(total);
+        state.mean += delta * weight;
+        state.m2 += other.m2 +
+            delta * delta * static_cast<X>(state.count) * weight;
+        state.sum += other.sum;
+        state.sumSquares += other.sumSquares;
+        if (other.min < state.min) {
+            state.min = other.min;
+        }
+        if (other.max > state.max) {
+            state.max = other.max;
+        }
+        if (other.absMax > state.absMax) {
+            state.absMax = other.absMax;
+            state.absMaxIndex = state.count + other.absMaxIndex;
+        }
+        state.count = total;
+    }
+
+    SummaryState<double> summaryKernel(const double* data, std::size_t count);
+    SummaryState<float> summaryKernel(const float* data, std::size_t count);
+
+    /* set bit ii % 64 of mask[ii / 64] if data[ii] op value is true for
+    count values and return the number of bits set*/
+    std::size_t compareMaskKernel(
+        const double* data,
+        std::size_t count,
+        double value,
+        comparison_op op,
+        std::uint64_t* mask);
+    std::size_t compareMaskKernel(
+        const float* data,
+        std::size_t count,
+        float value,
+        comparison_op op,
+        std::uint64_t* mask);
+    std::size_t compareMaskKernel(
+        const std::int64_t* data,
+        std::size_t count,
+        std::int64_t value,
+        comparison_op op,
+        std::uint64_t* mask);
+    std::size_t compareMaskKernel(
+        const std::int32_t* data,
+        std::size_t count,
+        std::int32_t value,
+        comparison_op op,
+        std::uint64_t* mask);
+
+    /** true if the vectorized kernels support the type*/
+    template<class X>
+    constexpr bool has_reduction_kernel_v = std::is_same_v<X, double> ||
+        std::is_same_v<X, float> || std::is_same_v<X, std::int64_t> ||
+        std::is_same_v<X, std::int32_t>;
+
+    /** true if the kernel sums give the same result as the sequential order,
+    integer addition is associative*/
+    template<class X>
+    constexpr bool exact_sum_kernel_v =
+        has_reduction_kernel_v<X> && std::is_integral_v<X>;
+}  // namespace vectorOpsDetail
+
+/** sum the values of a span
+@tparam X the type of the values
+@param[in] a the values to sum
+@return the sum as the same type as the values
+*/
+template<class X>
+std::remove_cv_t<X> sum(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::exact_sum_kernel_v<value_type>) {
+        return vectorOpsDetail::sumKernel(a.data(), a.size());
+    } else {
+        return vectorOpsDetail::sum<value_type>(a);
+    }
+}
+
+/** sum the values of a span with a chosen evaluation order
+@details with reduction_order::reassociate float and double values are summed
+with vectorized independent partial sums
+*/
+template<class X>
+std::remove_cv_t<X> sum(std::span<X> a, reduction_order order)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        if (order == reduction_order::reassociate) {
+            return vectorOpsDetail::sumKernel(a.data(), a.size());
+        }
+    }
+    return sum(a);
+}
+
+/** sum the values of a strided view*/
+template<class X>
+std::remove_cv_t<X> sum(StridedSpan<X> a)
+{
+    return vectorOpsDetail::sum<std::remove_cv_t<X>>(a);
+}
+
 /** sum a vector
 @tparam X the type of the vector
 @param[in] a the vector to sum the contents
@@ -129,8 +543,14 @@ constexpr M signn(M x)
 template<class X>
 X sum(const std::vector<X>& a)
 {
-    X sum_of_vector = std::accumulate(a.cbegin(), a.cend(), X(0));
-    return sum_of_vector;
+    return sum(std::span<const X>(a));
+}
+
+/** sum a vector with a chosen evaluation order*/
+template<class X>
+X sum(const std::vector<X>& a, reduction_order order)
+{
+    return sum(std::span<const X>(a), order);
 }
 
 /** check that a vector has the requested number of elements if not resize
@@ -156,16 +576,60 @@ void ensureSizeAtLeast(
     }
 }
 
+/** generate the mean of a span sum(X)/size(X)*/
+template<class X>
+std::remove_cv_t<X> mean(std::span<X> a)
+{
+    return vectorOpsDetail::mean<std::remove_cv_t<X>>(a);
+}
+
+/** generate the mean of a strided view*/
+template<class X>
+std::remove_cv_t<X> mean(StridedSpan<X> a)
+{
+    return vectorOpsDetail::mean<std::remove_cv_t<X>>(a);
+}
+
 /** generate the mean of a vector sum(X)/size(X)*/
 template<class X>
 X mean(const std::vector<X>& a)
 {
-    X sum_of_vector = std::accumulate(a.begin(), a.end(), X(0));
-    if (!a.empty()) {
-        sum_of_vector /= static_cast<X>(a.size());
+    return mean(std::span<const X>(a));
+}
+
+/** calculate the sum of the absolute values of a span
+@tparam X the type of the values must have std::abs defined
+*/
+template<class X>
+std::remove_cv_t<X> absSum(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::exact_sum_kernel_v<value_type>) {
+        return vectorOpsDetail::absSumKernel(a.data(), a.size());
+    } else {
+        return vectorOpsDetail::absSum<value_type>(a);
     }
+}
 
-    return sum_of_vector;
+/** calculate the sum of the absolute values of a span with a chosen
+evaluation order*/
+template<class X>
+std::remove_cv_t<X> absSum(std::span<X> a, reduction_order order)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        if (order == reduction_order::reassociate) {
+            return vectorOpsDetail::absSumKernel(a.data(), a.size());
+        }
+    }
+    return absSum(a);
+}
+
+/** calculate the sum of the absolute values of a strided view*/
+template<class X>
+std::remove_cv_t<X> absSum(StridedSpan<X> a)
+{
+    return vectorOpsDetail::absSum<std::remove_cv_t<X>>(a);
 }
 
 /** calculate the sum of the absolute values of a vector
@@ -175,11 +639,41 @@ operator
 template<class X>
 X absSum(const std::vector<X>& a)
 {
-    X sum_of_vector =
-        std::accumulate(a.begin(), a.end(), X(0), [](X a1, X a2) -> X {
-            return a1 + std::abs(a2);
-        });
-    return sum_of_vector;
+    return absSum(std::span<const X>(a));
+}
+
+/** calculate the sum of the absolute values of a vector with a chosen
+evaluation order*/
+template<class X>
+X absSum(const std::vector<X>& a, reduction_order order)
+{
+    return absSum(std::span<const X>(a), order);
+}
+
+/** calculate the maximum absolute value of a span
+@tparam X the type of the values must have std::abs defined
+@details the maximum does not depend on the evaluation order so float,
+double, std::int32_t and std::int64_t values always use the vectorized kernel,
+NaN values are ignored
+@return the maximum absolute value, 0 if the span is empty or holds only NaN
+values
+*/
+template<class X>
+std::remove_cv_t<X> absMax(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        return vectorOpsDetail::absMaxKernel(a.data(), a.size());
+    } else {
+        return vectorOpsDetail::absMax<value_type>(a);
+    }
+}
+
+/** calculate the maximum absolute value of a strided view*/
+template<class X>
+std::remove_cv_t<X> absMax(StridedSpan<X> a)
+{
+    return vectorOpsDetail::absMax<std::remove_cv_t<X>>(a);
 }
 
 /** calculate the maximum absolute value of a vector
@@ -189,16 +683,31 @@ operator
 template<class X>
 X absMax(const std::vector<X>& a)
 {
-    // auto result = std::minmax_element (a.begin (), a.end ());
-    // return std::max (std::abs (*(result.first)),std::abs
-    // (*(result.second)));
+    return absMax(std::span<const X>(a));
+}
 
-    X max_of_vector =
-        std::accumulate(a.begin(), a.end(), X(0), [](X a1, X a2) -> X {
-            auto absA = std::abs(a2);
-            return (a1 < absA) ? absA : a1;
-        });
-    return max_of_vector;
+/** calculate the maximum absolute value of a span and return its location
+@tparam X the type of the values must have std::abs defined
+@details NaN values are ignored
+@return a pair the first element is the absMax value the second is the index
+of its first occurrence, (0,-1) if the span is empty or holds only NaN values
+*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> absMaxLoc(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::absValue<value_type>, std::greater<value_type>());
+}
+
+/** calculate the maximum absolute value of a strided view and return its
+location*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> absMaxLoc(StridedSpan<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::absValue<value_type>, std::greater<value_type>());
 }
 
 /** calculate the maximum absolute value of a vector and return its location
@@ -210,22 +719,89 @@ into the vector
 template<class X>
 std::pair<X, int> absMaxLoc(const std::vector<X>& a)
 {
-    auto result = std::minmax_element(a.begin(), a.end());
-    X a1 = std::abs(*(result.first));
-    X a2 = std::abs(*(result.second));
-    return (a1 > a2) ? std::make_pair(a1, result.first - a.begin()) :
-                       std::make_pair(a2, result.second - a.begin());
+    return absMaxLoc(std::span<const X>(a));
 }
 
-/** calculate the maximum absolute value of a vector
+/** calculate the minimum absolute value of a span
+@tparam X the type of the values must have std::abs defined
+@details float, double, std::int32_t and std::int64_t values use the
+vectorized kernel, NaN values are ignored
+@return the minimum absolute value, 0 if the span is empty or holds only NaN
+values
+*/
+template<class X>
+std::remove_cv_t<X> absMin(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        if (a.empty()) {
+            return value_type(0);
+        }
+        const value_type result =
+            vectorOpsDetail::absMinKernel(a.data(), a.size());
+        if constexpr (std::is_floating_point_v<value_type>) {
+            // the kernel starts from infinity and skips every NaN
+            if (std::isinf(result) &&
+                std::all_of(a.begin(), a.end(), [](value_type value) {
+                    return std::isnan(value);
+                })) {
+                return value_type(0);
+            }
+        }
+        return result;
+    } else {
+        return vectorOpsDetail::bestLoc<value_type>(
+                   a,
+                   vectorOpsDetail::absValue<value_type>,
+                   std::less<value_type>())
+            .first;
+    }
+}
+
+/** calculate the minimum absolute value of a strided view*/
+template<class X>
+std::remove_cv_t<X> absMin(StridedSpan<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+               a,
+               vectorOpsDetail::absValue<value_type>,
+               std::less<value_type>())
+        .first;
+}
+
+/** calculate the minimum absolute value of a vector
 @tparam X the type of the vector must define a negation operator and a <
 operator
 */
 template<class X>
 X absMin(const std::vector<X>& a)
 {
-    auto result = std::minmax_element(a.begin(), a.end());
-    return std::min(std::abs(*(result.first)), std::abs(*(result.second)));
+    return absMin(std::span<const X>(a));
+}
+
+/** calculate the minimum absolute value of a span and return its location
+@tparam X the type of the values must have std::abs defined
+@details NaN values are ignored
+@return a pair the first element is the absMin value the second is the index
+of its first occurrence, (0,-1) if the span is empty or holds only NaN values
+*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> absMinLoc(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::absValue<value_type>, std::less<value_type>());
+}
+
+/** calculate the minimum absolute value of a strided view and return its
+location*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> absMinLoc(StridedSpan<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::absValue<value_type>, std::less<value_type>());
 }
 
 /** calculate the minimum absolute value of a vector and return its location
@@ -237,11 +813,29 @@ into the vector
 template<class X>
 std::pair<X, int> absMinLoc(const std::vector<X>& a)
 {
-    auto result = std::minmax_element(a.begin(), a.end());
-    X a1 = std::abs(*(result.first));
-    X a2 = std::abs(*(result.second));
-    return (a1 <= a2) ? std::make_pair(a1, result.first - a.begin()) :
-                        std::make_pair(a2, result.second - a.begin());
+    return absMinLoc(std::span<const X>(a));
+}
+
+/** calculate the maximum value of a span and return its location
+@details NaN values are ignored
+@return a pair the first element is the Max value the second is the index of
+its first occurrence, (0,-1) if the span is empty or holds only NaN values
+*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> maxLoc(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::identity<value_type>, std::greater<value_type>());
+}
+
+/** calculate the maximum value of a strided view and return its location*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> maxLoc(StridedSpan<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::identity<value_type>, std::greater<value_type>());
 }
 
 /** calculate the maximum value of a vector and return its location
@@ -253,9 +847,29 @@ the vector
 template<class X>
 std::pair<X, int> maxLoc(const std::vector<X>& a)
 {
-    auto result = std::max_element(a.begin(), a.end());
-    X a1 = *result;
-    return std::make_pair(a1, result - a.begin());
+    return maxLoc(std::span<const X>(a));
+}
+
+/** calculate the minimum value of a span and return its location
+@details NaN values are ignored
+@return a pair the first element is the Min value the second is the index of
+its first occurrence, (0,-1) if the span is empty or holds only NaN values
+*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> minLoc(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::identity<value_type>, std::less<value_type>());
+}
+
+/** calculate the minimum value of a strided view and return its location*/
+template<class X>
+std::pair<std::remove_cv_t<X>, int> minLoc(StridedSpan<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    return vectorOpsDetail::bestLoc<value_type>(
+        a, vectorOpsDetail::identity<value_type>, std::less<value_type>());
 }
 
 /** calculate the minimum value of a vector and return its location
@@ -267,40 +881,50 @@ the vector
 template<class X>
 std::pair<X, int> minLoc(const std::vector<X>& a)
 {
-    auto result = std::min_element(a.begin(), a.end());
-    X a1 = *result;
-    return std::make_pair(a1, result - a.begin());
+    return minLoc(std::span<const X>(a));
 }
 
-/** calculate the maximum absolute difference between values in two vectors
+/** calculate the maximum absolute difference between values in two spans
 and return the maximum difference and the location
-@tparam X the type of the vector must have std::abs defined
+@tparam X the type of the values must have std::abs defined
 @return a pair the first element is the absMax value the second is the index
-into the vector
+of its first occurrence, -1 if there is no difference
 */
 template<class X>
-auto absMaxDiffLoc(const std::vector<X>& a, const std::vector<X>& b)
+auto absMaxDiffLoc(std::span<const X> a, std::span<const X> b)
 {
     int loc = -1;
-
-    auto cnt = (std::min)(a.size(), b.size());
-    auto abeg = a.begin();
-    auto acur = abeg;
-    auto bcur = b.begin();
-    auto aend = abeg + cnt;
-    auto mdiff = decltype(std::abs(*acur - *bcur))(0);
-    while (acur < aend) {
-        auto adiff = std::abs(*acur - *bcur);
+    const auto cnt = (std::min)(a.size(), b.size());
+    auto mdiff = decltype(std::abs(a[0] - b[0]))(0);
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        auto adiff = std::abs(a[ii] - b[ii]);
         if (adiff > mdiff) {
-            loc = acur - abeg;
+            loc = static_cast<int>(ii);
             mdiff = adiff;
         }
-        ++acur;
-        ++bcur;
     }
     return std::make_pair(mdiff, loc);
 }
 
+/** calculate the maximum absolute difference between values in two vectors
+and return the maximum difference and the location
+@tparam X the type of the vector must have std::abs defined
+@return a pair the first element is the absMax value the second is the index
+into the vector
+*/
+template<class X>
+auto absMaxDiffLoc(const std::vector<X>& a, const std::vector<X>& b)
+{
+    return absMaxDiffLoc(std::span<const X>(a), std::span<const X>(b));
+}
+
+/** calculate the maximum absolute difference between values in two spans*/
+template<class X>
+auto absMaxDiff(std::span<const X> a, std::span<const X> b)
+{
+    return absMaxDiffLoc(a, b).first;
+}
+
 /** calculate the maximum absolute difference between values in two vectors
 and return the maximum difference
 @tparam X the type of the vector must have std::abs defined
@@ -313,6 +937,41 @@ auto absMaxDiff(const std::vector<X>& a, const std::vector<X>& b)
     return res.first;
 }
 
+/** calculate the product of all the values in a span
+@return the product of all the values, 1 for an empty span
+*/
+template<class X>
+std::remove_cv_t<X> product(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::exact_sum_kernel_v<value_type>) {
+        return vectorOpsDetail::productKernel(a.data(), a.size());
+    } else {
+        return vectorOpsDetail::product<value_type>(a);
+    }
+}
+
+/** calculate the product of all the values in a span with a chosen
+evaluation order*/
+template<class X>
+std::remove_cv_t<X> product(std::span<X> a, reduction_order order)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        if (order == reduction_order::reassociate) {
+            return vectorOpsDetail::productKernel(a.data(), a.size());
+        }
+    }
+    return product(a);
+}
+
+/** calculate the product of all the values in a strided view*/
+template<class X>
+std::remove_cv_t<X> product(StridedSpan<X> a)
+{
+    return vectorOpsDetail::product<std::remove_cv_t<X>>(a);
+}
+
 /** calculate the product of all the values in a vector
 @tparam X the type of the vector must have std::abs defined
 @return the product of all the value in a vector
@@ -320,11 +979,51 @@ auto absMaxDiff(const std::vector<X>& a, const std::vector<X>& b)
 template<class X>
 X product(const std::vector<X>& a)
 {
-    X prod_of_vector =
-        std::accumulate(a.begin(), a.end(), X(0), [](X a1, X a2) {
-            return a1 * a2;
-        });
-    return prod_of_vector;
+    return product(std::span<const X>(a));
+}
+
+/** calculate the product of all the values in a vector with a chosen
+evaluation order*/
+template<class X>
+X product(const std::vector<X>& a, reduction_order order)
+{
+    return product(std::span<const X>(a), order);
+}
+
+/** calculate the rms value of a span
+@return the square root of the sum of the squared values
+*/
+template<class X>
+std::remove_cv_t<X> rms(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::exact_sum_kernel_v<value_type>) {
+        return static_cast<value_type>(
+            std::sqrt(vectorOpsDetail::sumSquaresKernel(a.data(), a.size())));
+    } else {
+        return vectorOpsDetail::rms<value_type>(a);
+    }
+}
+
+/** calculate the rms value of a span with a chosen evaluation order*/
+template<class X>
+std::remove_cv_t<X> rms(std::span<X> a, reduction_order order)
+{
+    using value_type = std::remove_cv_t<X>;
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<value_type>) {
+        if (order == reduction_order::reassociate) {
+            return static_cast<value_type>(std::sqrt(
+                vectorOpsDetail::sumSquaresKernel(a.data(), a.size())));
+        }
+    }
+    return rms(a);
+}
+
+/** calculate the rms value of a strided view*/
+template<class X>
+std::remove_cv_t<X> rms(StridedSpan<X> a)
+{
+    return vectorOpsDetail::rms<std::remove_cv_t<X>>(a);
 }
 
 /** calculate the rms value of a vector
@@ -334,50 +1033,384 @@ X product(const std::vector<X>& a)
 template<class X>
 X rms(const std::vector<X>& a)
 {
-    X sum_of_vector =
-        std::accumulate(a.begin(), a.end(), 0.0, [](X a1, X a2) -> X {
-            return (a1 + (a2 * a2));
-        });
-    return std::sqrt(sum_of_vector);
+    return rms(std::span<const X>(a));
+}
+
+/** calculate the rms value of a vector with a chosen evaluation order*/
+template<class X>
+X rms(const std::vector<X>& a, reduction_order order)
+{
+    return rms(std::span<const X>(a), order);
+}
+
+/** compute the std deviation of a span*/
+template<class X>
+std::remove_cv_t<X> stdev(std::span<X> a)
+{
+    return vectorOpsDetail::stdev<std::remove_cv_t<X>>(a);
+}
+
+/** compute the std deviation of a strided view*/
+template<class X>
+std::remove_cv_t<X> stdev(StridedSpan<X> a)
+{
+    return vectorOpsDetail::stdev<std::remove_cv_t<X>>(a);
 }
 
 /** compute the std deviation of a vector*/
 template<class X>
 X stdev(const std::vector<X>& a)
 {
-    X mv = mean(a);
-    X sum_of_vector =
-        std::accumulate(a.begin(), a.end(), 0.0, [mv](X a1, X a2) -> X {
-            return (a1 + ((a2 - mv) * (a2 - mv)));
-        });
-    X ret = X(0);
-    if (!a.empty()) {
-        ret = std::sqrt(sum_of_vector / static_cast<X>(a.size()));
+    return stdev(std::span<const X>(a));
+}
+
+/** the descriptive statistics of a set of values*/
+template<class X>
+struct Summary {
+    std::size_t count{0};  //!< the number of values
+    X sum{0};  //!< the sum of the values
+    X mean{0};  //!< the arithmetic mean
+    X variance{0};  //!< the population variance, the square of stdev
+    X stdev{0};  //!< the population standard deviation
+    X min{0};  //!< the smallest value
+    X max{0};  //!< the largest value
+    X absMax{0};  //!< the largest absolute value
+    std::size_t absMaxIndex{0};  //!< the first index holding absMax
+    X rms{0};  //!< the square root of the sum of squares as in rms()
+};
+
+/** accumulate the statistics of a stream of values
+@details values are added in order, accumulators for consecutive pieces of a
+stream can be built independently, for example on different threads, and
+merged afterwards
+@tparam X a floating point type*/
+template<class X>
+class SummaryAccumulator {
+    static_assert(
+        std::is_floating_point_v<X>,
+        "SummaryAccumulator requires a floating point type");
+
+  public:
+    /** add a single value*/
+    void add(X value)
+    {
+        vectorOpsDetail::SummaryState<X> single;
+        single.count = 1;
+        single.sum = value;
+        single.mean = value;
+        single.sumSquares = value * value;
+        single.min = value;
+        single.max = value;
+        single.absMax = (value < X(0)) ? -value : value;
+        vectorOpsDetail::mergeSummary(state, single);
     }
-    return ret;
+    /** add a span of values in order*/
+    void add(std::span<const X> values)
+    {
+        if constexpr (
+            std::is_same_v<X, double> || std::is_same_v<X, float>) {
+            vectorOpsDetail::mergeSummary(
+                state,
+                vectorOpsDetail::summaryKernel(values.data(), values.size()));
+        } else {
+            for (const auto& value : values) {
+                add(value);
+            }
+        }
+    }
+    /** add the values of a strided view in order*/
+    void add(StridedSpan<const X> values)
+    {
+        for (std::size_t ii = 0; ii < values.size(); ++ii) {
+            add(values[ii]);
+        }
+    }
+    /** merge an accumulator of the values that follow those already added*/
+    void merge(const SummaryAccumulator& other)
+    {
+        vectorOpsDetail::mergeSummary(state, other.state);
+    }
+    /** get the number of values added*/
+    std::size_t count() const { return state.count; }
+    /** get the statistics of the values added so far*/
+    Summary<X> summary() const
+    {
+        Summary<X> result;
+        if (state.count == 0) {
+            return result;
+        }
+        result.count = state.count;
+        result.sum = state.sum;
+        result.mean = state.mean;
+        result.variance = state.m2 / static_cast<X>(state.count);
+        result.stdev = static_cast<X>(std::sqrt(result.variance));
+        result.min = state.min;
+        result.max = state.max;
+        result.absMax = state.absMax;
+        result.absMaxIndex = state.absMaxIndex;
+        result.rms = static_cast<X>(std::sqrt(state.sumSquares));
+        return result;
+    }
+    /** remove all the values*/
+    void clear() { state = vectorOpsDetail::SummaryState<X>{}; }
+
+  private:
+    vectorOpsDetail::SummaryState<X> state;
+};
+
+/** compute the descriptive statistics of a span in a single pass
+@details float and double use a vectorized kernel over cache sized blocks, so
+the sums may differ from sum() in the last bits, NaN values are skipped by
+min, max and absMax but propagate through the sums
+@return a Summary, all zero if the span is empty*/
+template<class X>
+Summary<std::remove_cv_t<X>> describe(std::span<X> a)
+{
+    SummaryAccumulator<std::remove_cv_t<X>> accumulator;
+    accumulator.add(a);
+    return accumulator.summary();
 }
 
-/** compute the median value in a vector and partially reorders the vector
+/** compute the descriptive statistics of a strided view*/
+template<class X>
+Summary<std::remove_cv_t<X>> describe(StridedSpan<X> a)
+{
+    SummaryAccumulator<std::remove_cv_t<X>> accumulator;
+    accumulator.add(a);
+    return accumulator.summary();
+}
+
+/** compute the descriptive statistics of a vector*/
+template<class X>
+Summary<X> describe(const std::vector<X>& a)
+{
+    return describe(std::span<const X>(a));
+}
+
+namespace vectorOpsDetail {
+    /** the rank and the interpolation fraction of a quantile in count sorted
+    values, probabilities outside [0,1] are clamped
+    @throw std::invalid_argument if the probability is NaN*/
+    inline std::pair<std::size_t, double>
+        quantileRank(std::size_t count, double probability)
+    {
+        if (std::isnan(probability)) {
+            throw std::invalid_argument("a quantile probability is NaN");
+        }
+        const double position = std::clamp(probability, 0.0, 1.0) *
+            static_cast<double>(count - 1);
+        const auto rank = static_cast<std::size_t>(position);
+        return {rank, position - static_cast<double>(rank)};
+    }
+
+    /** place every rank needed by the quantiles inside [first,last) in its
+    sorted position
+    @details the needed rank closest to the middle is selected and the two
+    sides are handled separately, so each element takes part in about log2 of
+    the number of quantiles partitions*/
+    template<class X>
+    void selectQuantileRanks(
+        std::span<X> a,
+        std::span<const double> probabilities,
+        std::size_t first,
+        std::size_t last)
+    {
+        while (first < last) {
+            const std::size_t middle = first + (last - first) / 2;
+            std::size_t best{last};
+            std::size_t bestDistance{last - first};
+            const auto consider = [&](std::size_t needed) {
+                if (needed < first || needed >= last) {
+                    return;
+                }
+                const std::size_t distance = (needed < middle) ?
+                    middle - needed :
+                    needed - middle;
+                if (distance < bestDistance) {
+                    best = needed;
+                    bestDistance = distance;
+                }
+            };
+            for (const double probability : probabilities) {
+                const auto rank = quantileRank(a.size(), probability);
+                consider(rank.first);
+                if (rank.second > 0.0) {
+                    consider(rank.first + 1);
+                }
+            }
+            if (best == last) {
+                return;
+            }
+            const auto begin = a.begin();
+            std::nth_element(
+                begin + static_cast<std::ptrdiff_t>(first),
+                begin + static_cast<std::ptrdiff_t>(best),
+                begin + static_cast<std::ptrdiff_t>(last));
+            selectQuantileRanks(a, probabilities, first, best);
+            first = best + 1;
+        }
+    }
+
+    /** the quantile of values whose needed ranks are already selected*/
+    template<class X>
+    X selectedQuantile(std::span<const X> a, double probability)
+    {
+        const auto rank = quantileRank(a.size(), probability);
+        if (rank.second == 0.0) {
+            return a[rank.first];
+        }
+        return static_cast<X>(
+            a[rank.first] + rank.second * (a[rank.first + 1] - a[rank.first]));
+    }
+}  // namespace vectorOpsDetail
+
+/** compute several quantiles of a span in one selection pass and partially
+reorder the span
+@details quantiles are interpolated linearly between the closest ranks, so
+the 0.5 quantile is the median, the work is done in place without allocating
+@param[in,out] a the values, reordered by the selection
+@param[in] probabilities the quantiles to find in [0,1], in any order
+@param[out] results the quantile for each probability, the first
+min(probabilities.size(), results.size()) are written
+@throw std::invalid_argument if a probability is NaN
+*/
+template<class X>
+void quantilesReorder(
+    std::span<X> a,
+    std::span<const double> probabilities,
+    std::span<X> results)
+{
+    const auto cnt = (std::min)(probabilities.size(), results.size());
+    if (a.empty()) {
+        // NaN probabilities are rejected for an empty span as well
+        for (std::size_t ii = 0; ii < cnt; ++ii) {
+            vectorOpsDetail::quantileRank(1, probabilities[ii]);
+        }
+        std::fill(results.begin(), results.begin() + cnt, X(0));
+        return;
+    }
+    vectorOpsDetail::selectQuantileRanks(
+        a, probabilities.first(cnt), 0, a.size());
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        results[ii] = vectorOpsDetail::selectedQuantile(
+            std::span<const X>(a), probabilities[ii]);
+    }
+}
+
+/** compute a quantile of a span and partially reorder the span
+@param[in,out] a the values, reordered by the selection
+@param probability the quantile to find in [0,1]
+@return the quantile interpolated between the closest ranks*/
+template<class X>
+X quantileReorder(std::span<X> a, double probability)
+{
+    X result(0);
+    quantilesReorder(
+        a,
+        std::span<const double>(&probability, 1),
+        std::span<X>(&result, 1));
+    return result;
+}
+
+/** compute several quantiles of a span without reordering it
+@details the values are copied once and all quantiles are selected together
+@return the quantile for each probability*/
+template<class X>
+std::vector<std::remove_cv_t<X>>
+    quantiles(std::span<X> a, std::span<const double> probabilities)
+{
+    using value_type = std::remove_cv_t<X>;
+    std::vector<value_type> b(a.begin(), a.end());
+    std::vector<value_type> results(probabilities.size());
+    quantilesReorder(
+        std::span<value_type>(b),
+        probabilities,
+        std::span<value_type>(results));
+    return results;
+}
+
+/** compute several quantiles of a const vector*/
+template<class X>
+std::vector<X> quantiles(
+    const std::vector<X>& a,
+    const std::vector<double>& probabilities)
+{
+    return quantiles(
+        std::span<const X>(a), std::span<const double>(probabilities));
+}
+
+/** compute a quantile of a span without reordering it*/
+template<class X>
+std::remove_cv_t<X> quantile(std::span<X> a, double probability)
+{
+    using value_type = std::remove_cv_t<X>;
+    std::vector<value_type> b(a.begin(), a.end());
+    return quantileReorder(std::span<value_type>(b), probability);
+}
+
+/** compute a quantile of a const vector*/
+template<class X>
+X quantile(const std::vector<X>& a, double probability)
+{
+    return quantile(std::span<const X>(a), probability);
+}
+
+/** compute the median value in a span and partially reorders the span
 according to nth_element
 @return the median value*/
 template<class X>
-X medianReorder(std::vector<X>& a)
+X medianReorder(std::span<X> a)
 {
+    if (a.empty()) {
+        return X(0);
+    }
     size_t n = a.size() / 2;
     std::nth_element(a.begin(), a.begin() + n, a.end());
     if (a.size() % 2 == 1) {
         return a[n];
     }
-    std::nth_element(a.begin(), a.begin() + n - 1, a.end());
-    return static_cast<X>(0.5 * (a[n] + a[n - 1]));
+    // the lower middle value is the largest of the lower partition
+    const X lower = *std::max_element(a.begin(), a.begin() + n);
+    return static_cast<X>(0.5 * (a[n] + lower));
+}
+
+/** compute the median value in a vector and partially reorders the vector
+according to nth_element
+@return the median value*/
+template<class X>
+X medianReorder(std::vector<X>& a)
+{
+    return medianReorder(std::span<X>(a));
 }
+
+/** compute the median value in a span without reordering it
+@return the median value*/
+template<class X>
+std::remove_cv_t<X> median(std::span<X> a)
+{
+    using value_type = std::remove_cv_t<X>;
+    std::vector<value_type> b(a.begin(), a.end());  // copy the values
+    return medianReorder(std::span<value_type>(b));
+}
+
 /** compute the median value in a const vector
 @return the median value*/
 template<class X>
 X median(const std::vector<X>& a)
 {
-    std::vector<X> b(a);  // copy the vector
-    return medianReorder(b);
+    return median(std::span<const X>(a));
+}
+
+/** compute the ordered difference between elements in a span
+@param[in] a the input values
+@return a new vector whose elements contain the differences in adjacent
+elements*/
+template<class X>
+auto diff(std::span<const X> a)
+{
+    std::vector<decltype(a[1] - a[0])> d(a.size());
+    std::adjacent_difference(a.begin(), a.end(), d.begin());
+    return d;
 }
 
 /** compute the ordered difference between elements in a vector
@@ -387,33 +1420,232 @@ elements*/
 template<class X>
 auto diff(const std::vector<X>& a)
 {
-    auto cnt = a.size();
-    std::vector<decltype(a[1] - a[0])> d(cnt);
-    std::adjacent_difference(a.begin(), a.end(), d.begin());
-    return d;
+    return diff(std::span<const X>(a));
 }
 
-/** generate a vector of indices where the values of a vector are equal to a
-given value
-@param a the vector of value to compare
-@param op the operation to check a bool function which takes a value as an input
+namespace vectorOpsDetail {
+    /** the number of values whose mask is built at once when finding
+    indices, the mask words stay on the stack*/
+    constexpr std::size_t findChunkSize{4096};
+
+    /** append offset plus the position of every set bit of the mask words
+    @param matches the number of bits set in the mask*/
+    template<class Y>
+    void appendMaskIndices(
+        std::vector<Y>& locs,
+        std::span<const std::uint64_t> mask,
+        std::size_t offset,
+        std::size_t matches)
+    {
+        std::size_t out = locs.size();
+        locs.resize(out + matches);
+        for (std::size_t word = 0; word < mask.size(); ++word) {
+            std::uint64_t bits = mask[word];
+            while (bits != 0) {
+                locs[out++] = static_cast<Y>(
+                    offset + word * 64 +
+                    static_cast<std::size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    /** set the mask bits of count values from start matching a condition
+    and return the number of bits set*/
+    template<class X, class Condition>
+    std::size_t conditionMask(
+        std::span<const X> a,
+        std::size_t start,
+        std::size_t count,
+        Condition& condition,
+        std::uint64_t* mask)
+    {
+        std::size_t matches{0};
+        for (std::size_t word = 0; word * 64 < count; ++word) {
+            const std::size_t first = start + word * 64;
+            const std::size_t length =
+                (std::min)(std::size_t{64}, count - word * 64);
+            std::uint64_t bits{0};
+            for (std::size_t bit = 0; bit < length; ++bit) {
+                bits |= static_cast<std::uint64_t>(
+                            static_cast<bool>(condition(a[first + bit])))
+                    << bit;
+            }
+            mask[word] = bits;
+            matches += static_cast<std::size_t>(std::popcount(bits));
+        }
+        return matches;
+    }
+
+    /** collect the indices from start to end of the values of a matching a
+    condition
+    @details the matches of a chunk are found as a bitmask, which the
+    compiler can vectorize for simple conditions, then the set bits are
+    expanded so the output grows once per chunk rather than once per match*/
+    template<class Y, class X, class Condition>
+    std::vector<Y> findIndices(
+        std::span<const X> a,
+        std::size_t start,
+        std::size_t end,
+        Condition condition)
+    {
+        end = (std::min)(end, a.size());
+        std::vector<Y> locs;
+        std::array<std::uint64_t, findChunkSize / 64> mask;
+        for (std::size_t ii = start; ii < end; ii += findChunkSize) {
+            const std::size_t length = (std::min)(findChunkSize, end - ii);
+            const std::size_t matches =
+                conditionMask(a, ii, length, condition, mask.data());
+            appendMaskIndices(
+                locs,
+                std::span<const std::uint64_t>(mask.data(), (length + 63) / 64),
+                ii,
+                matches);
+        }
+        return locs;
+    }
+
+    /** compare a value to a threshold*/
+    template<class X>
+    bool compareValue(X value, comparison_op op, X threshold)
+    {
+        switch (op) {
+            case comparison_op::equal:
+                return value == threshold;
+            case comparison_op::not_equal:
+                return value != threshold;
+            case comparison_op::less:
+                return value < threshold;
+            case comparison_op::less_equal:
+                return value <= threshold;
+            case comparison_op::greater:
+                return value > threshold;
+            case comparison_op::greater_equal:
+            default:
+                return value >= threshold;
+        }
+    }
+
+    /** collect the indices from start to end of the values of a for which
+    value op threshold is true, with the vectorized kernels if possible*/
+    template<class Y, class X>
+    std::vector<Y> findCompare(
+        std::span<const X> a,
+        std::size_t start,
+        std::size_t end,
+        comparison_op op,
+        X threshold)
+    {
+        if constexpr (has_reduction_kernel_v<X>) {
+            end = (std::min)(end, a.size());
+            std::vector<Y> locs;
+            std::array<std::uint64_t, findChunkSize / 64> mask;
+            for (std::size_t ii = start; ii < end; ii += findChunkSize) {
+                const std::size_t length = (std::min)(findChunkSize, end - ii);
+                const std::size_t matches = compareMaskKernel(
+                    a.data() + ii, length, threshold, op, mask.data());
+                appendMaskIndices(
+                    locs,
+                    std::span<const std::uint64_t>(
+                        mask.data(), (length + 63) / 64),
+                    ii,
+                    matches);
+            }
+            return locs;
+        } else {
+            return findIndices<Y>(a, start, end, [op, threshold](X value) {
+                return compareValue(value, op, threshold);
+            });
+        }
+    }
+}  // namespace vectorOpsDetail
+
+/** generate a vector of indices where the values of a span match a
+condition
+@param a the values to compare
+@param op the condition, any callable taking a value and returning a bool
 @return a vector of indices into a with the matching condition
+*/
+template<class X, class Predicate>
+auto vecFindOp(std::span<const X> a, Predicate op)
+{
+    return vectorOpsDetail::findIndices<std::size_t>(
+        a, 0, a.size(), std::move(op));
+}
 
+/** generate a vector of indices where the values of a vector match a
+condition
+@param a the vector of value to compare
+@param op the condition, any callable taking a value and returning a bool
+@return a vector of indices into a with the matching condition
 */
+template<class X, class Predicate>
+auto vecFindOp(const std::vector<X>& a, Predicate op)
+{
+    return vecFindOp(std::span<const X>(a), std::move(op));
+}
+
+/** compute a bitmask of the values of a span compared to a threshold
+@details bit ii % 64 of word ii / 64 is set if a[ii] op threshold is true,
+int32, int64, float and double use the vectorized kernels
+@return the mask words, (a.size() + 63) / 64 of them*/
 template<class X>
-auto vecFindOp(const std::vector<X>& a, std::function<bool(X)> op)
+std::vector<std::uint64_t>
+    vecFindMask(std::span<const X> a, comparison_op op, X threshold)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (op(a[ii])) {
-            locs.push_back(ii);
-        }
+    std::vector<std::uint64_t> mask((a.size() + 63) / 64);
+    if constexpr (vectorOpsDetail::has_reduction_kernel_v<X>) {
+        vectorOpsDetail::compareMaskKernel(
+            a.data(), a.size(), threshold, op, mask.data());
+    } else {
+        auto compare = [op, threshold](X value) {
+            return vectorOpsDetail::compareValue(value, op, threshold);
+        };
+        vectorOpsDetail::conditionMask(a, 0, a.size(), compare, mask.data());
     }
+    return mask;
+}
+
+/** compute a bitmask of the values of a vector compared to a threshold*/
+template<class X>
+std::vector<std::uint64_t>
+    vecFindMask(const std::vector<X>& a, comparison_op op, X threshold)
+{
+    return vecFindMask(std::span<const X>(a), op, threshold);
+}
+
+/** generate the indices of the bits set in a mask from vecFindMask
+@tparam Y the type of the indices desired
+@param mask the mask words
+@return the positions of the set bits in increasing order*/
+template<class Y = std::size_t>
+std::vector<Y> maskIndices(std::span<const std::uint64_t> mask)
+{
+    std::size_t matches{0};
+    for (const auto word : mask) {
+        matches += static_cast<std::size_t>(std::popcount(word));
+    }
+    std::vector<Y> locs;
+    vectorOpsDetail::appendMaskIndices(locs, mask, 0, matches);
     return locs;
 }
 
+/** generate the indices of the bits set in a vector of mask words*/
+template<class Y = std::size_t>
+std::vector<Y> maskIndices(const std::vector<std::uint64_t>& mask)
+{
+    return maskIndices<Y>(std::span<const std::uint64_t>(mask));
+}
+
+/** generate a vector of indices where the values of a span are equal to a
+given value*/
+template<class X>
+auto vecFindeq(std::span<const X> a, X match)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::equal, match);
+}
+
 /** generate a vector of indices where the values of a vector are equal to a
 given value
 @param a the vector of value to compare
@@ -423,15 +1655,16 @@ given value
 template<class X>
 auto vecFindeq(const std::vector<X>& a, X match)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] == match) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindeq(std::span<const X>(a), match);
+}
+
+/** generate a vector of indices where the values of a span are not equal to
+a given value*/
+template<class X>
+auto vecFindne(std::span<const X> a, X match)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::not_equal, match);
 }
 
 /** generate a vector of indices where the values of a vector are not equal
@@ -443,15 +1676,16 @@ to a given value
 template<class X>
 auto vecFindne(const std::vector<X>& a, X match)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] != match) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindne(std::span<const X>(a), match);
+}
+
+/** generate a vector of indices where the values of a span are not equal to
+a given value from index start up to but not including end*/
+template<class X>
+auto vecFindne(std::span<const X> a, X match, size_t start, size_t end)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, start, end, comparison_op::not_equal, match);
 }
 
 /** generate a vector of indices where the values of a vector are not equal
@@ -465,16 +1699,16 @@ to a given value within a defined range
 template<class X>
 auto vecFindne(const std::vector<X>& a, X match, size_t start, size_t end)
 {
-    auto cnt = a.size();
-    cnt = std::min(end, cnt);
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = start; ii < cnt; ++ii) {
-        if (a[ii] != match) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindne(std::span<const X>(a), match, start, end);
+}
+
+/** generate a vector of indices where the values of a span are less than a
+given value*/
+template<class X>
+auto vecFindlt(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::less, val);
 }
 
 /** generate a vector of indices where the values of a vector are less than
@@ -486,15 +1720,16 @@ a given value
 template<class X>
 auto vecFindlt(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] < val) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindlt(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices where the values of a span are less than or
+equal to a given value*/
+template<class X>
+auto vecFindlte(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::less_equal, val);
 }
 
 /** generate a vector of indices where the values of a vector are less than
@@ -506,15 +1741,16 @@ or equal to a given value
 template<class X>
 auto vecFindlte(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] <= val) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindlte(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices where the values of a span are greater than
+a given value*/
+template<class X>
+auto vecFindgt(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::greater, val);
 }
 
 /** generate a vector of indices where the values of a vector are greater
@@ -527,15 +1763,16 @@ than a given value
 template<class X>
 auto vecFindgt(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] > val) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindgt(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices where the values of a span are greater than
+or equal to a given value*/
+template<class X>
+auto vecFindgte(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<std::size_t>(
+        a, 0, a.size(), comparison_op::greater_equal, val);
 }
 
 /** generate a vector of indices where the values of a vector are greater or
@@ -548,15 +1785,16 @@ equal to a given value
 template<class X>
 auto vecFindgte(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<decltype(cnt)> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] >= val) {
-            locs.push_back(ii);
-        }
-    }
-    return locs;
+    return vecFindgte(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices of type Y where the values of a span are
+equal to a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindeq(std::span<const X> a, X match)
+{
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::equal, match);
 }
 
 /** generate a vector of indices where the values of a vector are equal to a
@@ -570,15 +1808,16 @@ given value
 template<class X, class Y>
 std::vector<Y> vecFindeq(const std::vector<X>& a, X match)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] == match) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vecFindeq<X, Y>(std::span<const X>(a), match);
+}
+
+/** generate a vector of indices of type Y where the values of a span are not
+equal to a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindne(std::span<const X> a, X match)
+{
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::not_equal, match);
 }
 
 /** generate a vector of indices where the values of a vector are not equal
@@ -592,15 +1831,18 @@ to a given value
 template<class X, class Y>
 std::vector<Y> vecFindne(const std::vector<X>& a, X match)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] != match) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vecFindne<X, Y>(std::span<const X>(a), match);
+}
+
+/** generate a vector of indices of type Y where the values of a span are not
+equal to a given value from index start up to and including end*/
+template<class X, class Y>
+std::vector<Y>
+    vecFindne(std::span<const X> a, X match, size_t start, size_t end)
+{
+    const std::size_t last = (end < a.size()) ? end + 1 : a.size();
+    return vectorOpsDetail::findCompare<Y>(
+        a, start, last, comparison_op::not_equal, match);
 }
 
 /** generate a vector of indices where the values of a vector are not equal
@@ -617,16 +1859,16 @@ template<class X, class Y>
 std::vector<Y>
     vecFindne(const std::vector<X>& a, X match, size_t start, size_t end)
 {
-    auto cnt = a.size();
-    cnt = std::min(end + 1, cnt);
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = start; ii < cnt; ++ii) {
-        if (a[ii] != match) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vecFindne<X, Y>(std::span<const X>(a), match, start, end);
+}
+
+/** generate a vector of indices of type Y where the values of a span are
+less than a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindlt(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::less, val);
 }
 
 /** generate a vector of indices where the values of a vector are less than
@@ -640,15 +1882,16 @@ a given value
 template<class X, class Y>
 std::vector<Y> vecFindlt(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] < val) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vecFindlt<X, Y>(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices of type Y where the values of a span are
+less than or equal to a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindlte(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::less_equal, val);
 }
 
 /** generate a vector of indices where the values of a vector are less than
@@ -660,18 +1903,20 @@ or equal to a given value
 @return a vector of indices into a with the matching condition
 */
 template<class X, class Y>
-std::vector<Y> vecFindlte(const std::vector<X>& a, X val)
+std::vector<Y> vecFindlte(const std::vector<X>& a, X val)
+{
+    return vecFindlte<X, Y>(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices of type Y where the values of a span are
+greater than a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindgt(std::span<const X> a, X val)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] <= val) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::greater, val);
 }
+
 /** generate a vector of indices where the values of a vector are greater
 than a given value
 @tparam X the type of the values
@@ -683,16 +1928,18 @@ than a given value
 template<class X, class Y>
 std::vector<Y> vecFindgt(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] > val) {
-            locs.push_back(static_cast<Y>(ii));
-        }
-    }
-    return locs;
+    return vecFindgt<X, Y>(std::span<const X>(a), val);
+}
+
+/** generate a vector of indices of type Y where the values of a span are
+greater than or equal to a given value*/
+template<class X, class Y>
+std::vector<Y> vecFindgte(std::span<const X> a, X val)
+{
+    return vectorOpsDetail::findCompare<Y>(
+        a, 0, a.size(), comparison_op::greater_equal, val);
 }
+
 /** generate a vector of indices where the values of a vector are greater
 than or equal to a given value
 @tparam X the type of the values
@@ -704,15 +1951,22 @@ than or equal to a given value
 template<class X, class Y>
 std::vector<Y> vecFindgte(const std::vector<X>& a, X val)
 {
-    auto cnt = a.size();
-    std::vector<Y> locs;
-    locs.reserve(cnt);
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (a[ii] >= val) {
-            locs.push_back(static_cast<Y>(ii));
+    return vecFindgte<X, Y>(std::span<const X>(a), val);
+}
+
+/** sum the elements of a span where an indicator span matches a defined
+ * value*/
+template<class X, class Y>
+X ind_sum(std::span<const X> a, std::span<const Y> b, Y match)
+{
+    const auto cnt = (std::min)(a.size(), b.size());
+    X sum_of_vector = 0;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if (b[ii] == match) {
+            sum_of_vector += a[ii];
         }
     }
-    return locs;
+    return sum_of_vector;
 }
 
 /** sum a vector elements where an indicator function matches a defined
@@ -726,14 +1980,19 @@ std::vector<Y> vecFindgte(const std::vector<X>& a, X val)
 template<class X, class Y>
 X ind_sum(const std::vector<X>& a, const std::vector<Y>& b, Y match)
 {
-    typename std::vector<X>::size_type cnt = (std::min)(a.size(), b.size());
-    X sum_of_vector = 0;
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        if (b[ii] == match) {
-            sum_of_vector += a[ii];
-        }
+    return ind_sum(std::span<const X>(a), std::span<const Y>(b), match);
+}
+
+/** multiply two spans and sum the result*/
+template<class X>
+X mult_sum(std::span<const X> a, std::span<const X> b)
+{
+    X sum_of_vector_mult = 0;
+    const auto cnt = (std::min)(a.size(), b.size());
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        sum_of_vector_mult += a[ii] * b[ii];
     }
-    return sum_of_vector;
+    return sum_of_vector_mult;
 }
 
 /** multiply two vectors and sum the result
@@ -743,12 +2002,19 @@ X ind_sum(const std::vector<X>& a, const std::vector<Y>& b, Y match)
 template<class X>
 X mult_sum(const std::vector<X>& a, const std::vector<X>& b)
 {
-    X sum_of_vector_mult = 0;
-    typename std::vector<X>::size_type cnt = (std::min)(a.size(), b.size());
-    for (decltype(cnt) ii = 0; ii < cnt; ++ii) {
-        sum_of_vector_mult += a[ii] * b[ii];
-    }
-    return sum_of_vector_mult;
+    return mult_sum(std::span<const X>(a), std::span<const X>(b));
+}
+
+/** add a span to another and store the result in the first span
+@param[in,out] a span 1
+@param[in] b span 2
+*/
+template<class X>
+void vectorAdd(std::span<X> a, std::span<const X> b)
+{
+    const auto cnt = (std::min)(a.size(), b.size());
+    std::transform(
+        a.begin(), a.begin() + cnt, b.begin(), a.begin(), std::plus<X>());
 }
 
 /** add a vector from another and store the result in the original vector
@@ -758,8 +2024,19 @@ X mult_sum(const std::vector<X>& a, const std::vector<X>& b)
 template<class X>
 void vectorAdd(std::vector<X>& a, const std::vector<X>& b)
 {
-    auto cnt = (std::min)(a.size(), b.size());
-    std::transform(a.begin(), a + cnt, b.begin(), a.begin(), std::plus<X>());
+    vectorAdd(std::span<X>(a), std::span<const X>(b));
+}
+
+/** subtract a span from another and store the result in the first span
+@param[in,out] a span 1
+@param[in] b span 2
+*/
+template<class X>
+void vectorSubtract(std::span<X> a, std::span<const X> b)
+{
+    const auto cnt = (std::min)(a.size(), b.size());
+    std::transform(
+        a.begin(), a.begin() + cnt, b.begin(), a.begin(), std::minus<X>());
 }
 
 /** subtract a vector from another and store the result in the original
@@ -770,8 +2047,22 @@ vector
 template<class X>
 void vectorSubtract(std::vector<X>& a, const std::vector<X>& b)
 {
-    auto cnt = (std::min)(a.size(), b.size());
-    std::transform(a.begin(), a + cnt, b.begin(), a.begin(), std::minus<X>());
+    vectorSubtract(std::span<X>(a), std::span<const X>(b));
+}
+
+/** multiply two spans and store the result
+@details the product of the first min(a.size(), b.size(), M.size()) elements
+is stored
+@param[in] a span 1
+@param[in] b span 2
+@param[out] M the location to store the result
+*/
+template<class X>
+void vectorMult(std::span<const X> a, std::span<const X> b, std::span<X> M)
+{
+    const auto cnt = (std::min)({a.size(), b.size(), M.size()});
+    std::transform(
+        a.begin(), a.begin() + cnt, b.begin(), M.begin(), std::multiplies<X>());
 }
 
 /** multiply a two vectors and store the result
@@ -785,10 +2076,28 @@ void vectorMult(
     const std::vector<X>& b,
     std::vector<X>& M)
 {
-    auto cnt = (std::min)(a.size(), b.size());
-    M.resize(cnt);
-    std::transform(
-        a.begin(), a + cnt, b.begin(), M.begin(), std::multiplies<X>());
+    M.resize((std::min)(a.size(), b.size()));
+    vectorMult(std::span<const X>(a), std::span<const X>(b), std::span<X>(M));
+}
+
+/** multiply a span by a constant and add a second span and store the result
+@details the first min(a.size(), b.size(), res.size()) elements are computed
+@param[in] a span 1
+@param[in] b span 2
+@param[in] Multiplier the multiplication factor
+@param[out] res the location to store the result
+*/
+template<class X>
+void vectorMultAdd(
+    std::span<const X> a,
+    std::span<const X> b,
+    const X Multiplier,
+    std::span<X> res)
+{
+    const auto cnt = (std::min)({a.size(), b.size(), res.size()});
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        res[ii] = std::fma(Multiplier, b[ii], a[ii]);  // fast multiply add
+    }
 }
 
 /** multiply a vector by a constant and add a second vector and store the
@@ -805,10 +2114,37 @@ void vectorMultAdd(
     const X Multiplier,
     std::vector<X>& res)
 {
-    auto cnt = (std::min)(a.size(), b.size());
-    for (typename std::vector<X>::size_type ii = 0; ii < cnt; ++ii) {
-        res[ii] = std::fma(Multiplier, b[ii], a[ii]);  // fast multiply add
+    vectorMultAdd(
+        std::span<const X>(a),
+        std::span<const X>(b),
+        Multiplier,
+        std::span<X>(res));
+}
+
+/** sum the absolute differences between two spans
+@param a the first span
+@param b the second span
+@param[out] diff the absolute values of the differences, the first cnt
+elements are written
+@param cnt the number of elements to compare and sum, 0 for all, limited by
+the sizes of a, b and diff
+@return the sum of the absolute values of the differences
+*/
+template<class X>
+X compareVec(
+    std::span<const X> a,
+    std::span<const X> b,
+    std::span<X> diff,
+    std::size_t cnt = 0)
+{
+    X sum_of_diff = 0;
+    cnt = (cnt == 0) ? (a.size()) : (std::min)(a.size(), cnt);
+    cnt = (std::min)({b.size(), diff.size(), cnt});
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        diff[ii] = std::abs(a[ii] - b[ii]);
+        sum_of_diff += diff[ii];
     }
+    return sum_of_diff;
 }
 
 /** sum the absolute differences between two Vectors
@@ -825,16 +2161,32 @@ X compareVec(
     std::vector<X>& diff,
     typename std::vector<X>::size_type cnt = 0)
 {
-    X sum_of_diff = 0;
     cnt = (cnt == 0) ? (a.size()) : (std::min)(a.size(), cnt);
     cnt = (std::min)(b.size(), cnt);
     diff.resize(cnt);
-    for (typename std::vector<X>::size_type ii = 0; ii < 0; ++ii) {
-        diff[ii] = std::abs(a[ii] - b[ii]);
-        sum_of_diff += diff[ii];
+    return compareVec(
+        std::span<const X>(a), std::span<const X>(b), std::span<X>(diff), cnt);
+}
+
+/** sum the absolute differences between two spans
+@param a the first span
+@param b the second span
+@param cnt the number of elements to compare and sum, 0 for all
+@return the sum of the absolute values of the differences
+*/
+template<class X>
+X compareVec(std::span<const X> a, std::span<const X> b, std::size_t cnt = 0)
+{
+    X sum_of_diff = 0;
+
+    cnt = (cnt == 0) ? (a.size()) : (std::min)(a.size(), cnt);
+    cnt = (std::min)(b.size(), cnt);
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        sum_of_diff += std::abs(a[ii] - b[ii]);
     }
     return sum_of_diff;
 }
+
 /** sum the absolute differences between two Vectors
 @param a the first vector
 @param b the second vector
@@ -847,14 +2199,23 @@ X compareVec(
     const std::vector<X>& b,
     typename std::vector<X>::size_type cnt = 0)
 {
-    X sum_of_diff = 0;
+    return compareVec(std::span<const X>(a), std::span<const X>(b), cnt);
+}
 
-    cnt = (cnt == 0) ? (a.size()) : (std::min)(a.size(), cnt);
-    cnt = (std::min)(b.size(), cnt);
-    for (typename std::vector<X>::size_type ii = 0; ii < cnt; ++ii) {
-        sum_of_diff += std::abs(a[ii] - b[ii]);
+/** count the differences between two spans if the difference is greater
+than a tolerance, elements present in only one of them count as differences*/
+template<class X>
+std::size_t
+    countDiffs(std::span<const X> a, std::span<const X> b, X maxAllowableDiff)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if (std::abs(a[ii] - b[ii]) > maxAllowableDiff) {
+            ++diffs;
+        }
     }
-    return sum_of_diff;
+    return diffs;
 }
 
 /** count the differences between two vectors if the difference is greater
@@ -869,12 +2230,212 @@ auto countDiffs(
     const std::vector<X>& b,
     X maxAllowableDiff)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    for (stype_t ii = 0; ii < cnt; ++ii) {
+    return countDiffs(
+        std::span<const X>(a), std::span<const X>(b), maxAllowableDiff);
+}
+
+/** sum the values of a span on several threads
+@details each block is summed with the vectorized kernels where available and
+the block sums are added in order, so the result does not depend on the
+number of threads but may differ from sum() in the last bits*/
+template<class X>
+X sum(std::span<const X> a, const ParallelOptions& options)
+{
+    return vectorOpsDetail::parallelBlockSum<X>(
+        a.size(), options, [a](std::size_t start, std::size_t length) {
+            return sum(a.subspan(start, length), reduction_order::reassociate);
+        });
+}
+
+/** sum the values of a vector on several threads*/
+template<class X>
+X sum(const std::vector<X>& a, const ParallelOptions& options)
+{
+    return sum(std::span<const X>(a), options);
+}
+
+/** sum the absolute differences between two spans on several threads
+@details the block results are added in order so the result does not depend
+on the number of threads*/
+template<class X>
+X compareVec(
+    std::span<const X> a,
+    std::span<const X> b,
+    const ParallelOptions& options)
+{
+    const auto cnt = (std::min)(a.size(), b.size());
+    return vectorOpsDetail::parallelBlockSum<X>(
+        cnt, options, [a, b](std::size_t start, std::size_t length) {
+            return compareVec(
+                a.subspan(start, length), b.subspan(start, length));
+        });
+}
+
+/** sum the absolute differences between two vectors on several threads*/
+template<class X>
+X compareVec(
+    const std::vector<X>& a,
+    const std::vector<X>& b,
+    const ParallelOptions& options)
+{
+    return compareVec(std::span<const X>(a), std::span<const X>(b), options);
+}
+
+/** count the differences between two spans greater than a tolerance on
+several threads, elements present in only one of them count as differences*/
+template<class X>
+std::size_t countDiffs(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff,
+    const ParallelOptions& options)
+{
+    const auto cnt = (std::min)(a.size(), b.size());
+    return (std::max)(a.size(), b.size()) - cnt +
+        vectorOpsDetail::parallelBlockSum<std::size_t>(
+               cnt,
+               options,
+               [a, b, maxAllowableDiff](std::size_t start, std::size_t length) {
+                   return countDiffs(
+                       a.subspan(start, length),
+                       b.subspan(start, length),
+                       maxAllowableDiff);
+               });
+}
+
+/** count the differences between two vectors greater than a tolerance on
+several threads*/
+template<class X>
+auto countDiffs(
+    const std::vector<X>& a,
+    const std::vector<X>& b,
+    X maxAllowableDiff,
+    const ParallelOptions& options)
+{
+    return countDiffs(
+        std::span<const X>(a),
+        std::span<const X>(b),
+        maxAllowableDiff,
+        options);
+}
+
+/** add a span to another on several threads and store the result in the
+first span*/
+template<class X>
+void vectorAdd(
+    std::span<X> a,
+    std::span<const X> b,
+    const ParallelOptions& options)
+{
+    vectorOpsDetail::parallelForBlocks(
+        (std::min)(a.size(), b.size()),
+        options,
+        [a, b](std::size_t /*block*/, std::size_t start, std::size_t length) {
+            vectorAdd(a.subspan(start, length), b.subspan(start, length));
+        });
+}
+
+/** add a vector to another on several threads and store the result in the
+first vector*/
+template<class X>
+void vectorAdd(
+    std::vector<X>& a,
+    const std::vector<X>& b,
+    const ParallelOptions& options)
+{
+    vectorAdd(std::span<X>(a), std::span<const X>(b), options);
+}
+
+/** subtract a span from another on several threads and store the result in
+the first span*/
+template<class X>
+void vectorSubtract(
+    std::span<X> a,
+    std::span<const X> b,
+    const ParallelOptions& options)
+{
+    vectorOpsDetail::parallelForBlocks(
+        (std::min)(a.size(), b.size()),
+        options,
+        [a, b](std::size_t /*block*/, std::size_t start, std::size_t length) {
+            vectorSubtract(a.subspan(start, length), b.subspan(start, length));
+        });
+}
+
+/** subtract a vector from another on several threads and store the result
+in the first vector*/
+template<class X>
+void vectorSubtract(
+    std::vector<X>& a,
+    const std::vector<X>& b,
+    const ParallelOptions& options)
+{
+    vectorSubtract(std::span<X>(a), std::span<const X>(b), options);
+}
+
+/** multiply a span by a constant and add a second span on several threads
+and store the result*/
+template<class X>
+void vectorMultAdd(
+    std::span<const X> a,
+    std::span<const X> b,
+    const X Multiplier,
+    std::span<X> res,
+    const ParallelOptions& options)
+{
+    vectorOpsDetail::parallelForBlocks(
+        (std::min)({a.size(), b.size(), res.size()}),
+        options,
+        [a, b, Multiplier, res](
+            std::size_t /*block*/, std::size_t start, std::size_t length) {
+            vectorMultAdd(
+                a.subspan(start, length),
+                b.subspan(start, length),
+                Multiplier,
+                res.subspan(start, length));
+        });
+}
+
+/** multiply a vector by a constant and add a second vector on several
+threads and store the result, res must be at least as long as the result*/
+template<class X>
+void vectorMultAdd(
+    const std::vector<X>& a,
+    const std::vector<X>& b,
+    const X Multiplier,
+    std::vector<X>& res,
+    const ParallelOptions& options)
+{
+    vectorMultAdd(
+        std::span<const X>(a),
+        std::span<const X>(b),
+        Multiplier,
+        std::span<X>(res),
+        options);
+}
+
+/** count the differences between two spans if the difference is greater
+than a tolerance, ignore a common mode difference between the two*/
+template<class X>
+std::size_t countDiffsIgnoreCommon(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    if (cnt < 3) {
+        return 0;
+    }
+    X commonDiff1 = a[0] - b[0];
+    X commonDiff2 = a[1] - b[1];
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
         if (std::abs(a[ii] - b[ii]) > maxAllowableDiff) {
-            ++diffs;
+            if (std::abs(a[ii] - b[ii] - commonDiff1) > maxAllowableDiff) {
+                if (std::abs(a[ii] - b[ii] - commonDiff2) > maxAllowableDiff) {
+                    ++diffs;
+                }
+            }
         }
     }
     return diffs;
@@ -892,21 +2453,25 @@ auto countDiffsIgnoreCommon(
     const std::vector<X>& b,
     X maxAllowableDiff)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    if (cnt < 3) {
-        return stype_t(0);
-    }
-    X commonDiff1 = a[0] - b[0];
-    X commonDiff2 = a[1] - b[1];
-    for (stype_t ii = 0; ii < cnt; ++ii) {
-        if (std::abs(a[ii] - b[ii]) > maxAllowableDiff) {
-            if (std::abs(a[ii] - b[ii] - commonDiff1) > maxAllowableDiff) {
-                if (std::abs(a[ii] - b[ii] - commonDiff2) > maxAllowableDiff) {
-                    ++diffs;
-                }
-            }
+    return countDiffsIgnoreCommon(
+        std::span<const X>(a), std::span<const X>(b), maxAllowableDiff);
+}
+
+/** count the differences between two spans if the difference is greater
+than both an absolute tolerance and a fraction of |a[ii]|*/
+template<class X>
+std::size_t countDiffs(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff,
+    X maxFracDiff)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) &&
+            (std::abs(a[ii] - b[ii]) > maxFracDiff * std::abs(a[ii]))) {
+            ++diffs;
         }
     }
     return diffs;
@@ -926,12 +2491,25 @@ auto countDiffs(
     X maxAllowableDiff,
     X maxFracDiff)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    for (stype_t ii = 0; ii < cnt; ++ii) {
-        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) &&
-            (std::abs(a[ii] - b[ii]) > maxFracDiff * std::abs(a[ii]))) {
+    return countDiffs(
+        std::span<const X>(a),
+        std::span<const X>(b),
+        maxAllowableDiff,
+        maxFracDiff);
+}
+
+/** count the differences between two spans if the difference is greater
+than a tolerance and the a value is valid (ie !=0)*/
+template<class X>
+std::size_t countDiffsIfValid(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) && (a[ii] != 0)) {
             ++diffs;
         }
     }
@@ -950,12 +2528,25 @@ auto countDiffsIfValid(
     const std::vector<X>& b,
     X maxAllowableDiff)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    for (stype_t ii = 0; ii < cnt; ++ii) {
-        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) && (a[ii] != 0)) {
+    return countDiffsIfValid(
+        std::span<const X>(a), std::span<const X>(b), maxAllowableDiff);
+}
+
+/** count the differences between two spans if the difference is greater
+than a tolerance and call a callback function for each difference*/
+template<class X>
+std::size_t countDiffsCallback(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff,
+    const std::function<void(std::size_t, X, X)>& f)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if (std::abs(a[ii] - b[ii]) > maxAllowableDiff) {
             ++diffs;
+            f(ii, a[ii], b[ii]);
         }
     }
     return diffs;
@@ -976,11 +2567,24 @@ auto countDiffsCallback(
     X maxAllowableDiff,
     std::function<void(typename std::vector<X>::size_type, X, X)>& f)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    for (stype_t ii = 0; ii < cnt; ++ii) {
-        if (std::abs(a[ii] - b[ii]) > maxAllowableDiff) {
+    return countDiffsCallback(
+        std::span<const X>(a), std::span<const X>(b), maxAllowableDiff, f);
+}
+
+/** count the differences between two spans if the difference is greater
+than a tolerance and the a value is valid (ie !=0) and call a callback function
+for each difference*/
+template<class X>
+std::size_t countDiffsIfValidCallback(
+    std::span<const X> a,
+    std::span<const X> b,
+    X maxAllowableDiff,
+    const std::function<void(std::size_t, X, X)>& f)
+{
+    const std::size_t cnt = (std::min)(a.size(), b.size());
+    std::size_t diffs = (std::max)(a.size(), b.size()) - cnt;
+    for (std::size_t ii = 0; ii < cnt; ++ii) {
+        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) && (a[ii] != X(0))) {
             ++diffs;
             f(ii, a[ii], b[ii]);
         }
@@ -1004,16 +2608,8 @@ auto countDiffsIfValidCallback(
     X maxAllowableDiff,
     std::function<void(typename std::vector<X>::size_type, X, X)>& f)
 {
-    using stype_t = typename std::vector<X>::size_type;
-    stype_t cnt = (std::min)(a.size(), b.size());
-    stype_t diffs = (std::max)(a.size(), b.size()) - cnt;
-    for (stype_t ii = 0; ii < cnt; ++ii) {
-        if ((std::abs(a[ii] - b[ii]) > maxAllowableDiff) && (a[ii] != X(0))) {
-            ++diffs;
-            f(ii, a[ii], b[ii]);
-        }
-    }
-    return diffs;
+    return countDiffsIfValidCallback(
+        std::span<const X>(a), std::span<const X>(b), maxAllowableDiff, f);
 }
 namespace vectorConvertDetail {
     template<typename Y, typename = void>
@@ -1050,6 +2646,21 @@ std::vector<X> vectorConvert(std::vector<Y>&& dvec)
     }
 }
 
+/** convert a span of one type into a vector of another type
+@tparam X the desired resultant type
+@tparam Y the original type
+@param dvec the values to convert
+*/
+template<typename X, typename Y>
+std::vector<X> vectorConvert(std::span<const Y> dvec)
+{
+    std::vector<X> ret(dvec.size());
+    std::transform(dvec.begin(), dvec.end(), ret.begin(), [](const Y& val) {
+        return static_cast<X>(val);
+    });
+    return ret;
+}
+
 /** convert a vector of one type into a vector of another type
 @tparam X the desired resultant type
 @tparam Y the original type
@@ -0,0 +1,557 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "vectorOps.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+/* The reduction kernels keep several independent blocks of partial results
+so consecutive additions do not wait on each other and each block maps onto
+SIMD registers. With GCC the blocks are 64 byte vector extension types and on
+x86-64 Linux every kernel is compiled for AVX-512, AVX2 and the baseline
+SSE2 with the best version selected when the program is loaded. Other
+compilers get the same unrolled scalar structure*/
+
+#if defined(__GNUC__) && !defined(__clang__)
+#    define GMLC_UTILITIES_VECTOR_BLOCKS
+#    pragma GCC diagnostic ignored "-Wpsabi"
+#    if defined(__x86_64__) && defined(__linux__)
+#        define GMLC_UTILITIES_REDUCTION_KERNEL                                \
+            __attribute__((target_clones("avx512f", "avx2", "default")))
+#    endif
+#endif
+#ifndef GMLC_UTILITIES_REDUCTION_KERNEL
+#    define GMLC_UTILITIES_REDUCTION_KERNEL
+#endif
+
+#ifdef GMLC_UTILITIES_VECTOR_BLOCKS
+#    define GMLC_UTILITIES_ALWAYS_INLINE [[gnu::always_inline]] inline
+// kernels built from templates in the headers inline all of them so the
+// template code is compiled for the target of each clone
+#    define GMLC_UTILITIES_FLATTEN [[gnu::flatten]]
+#else
+#    define GMLC_UTILITIES_ALWAYS_INLINE inline
+#    define GMLC_UTILITIES_FLATTEN
+#endif
+
+namespace gmlc::utilities::vectorOpsDetail {
+namespace {
+    /** the block of lanes reduced together*/
+    template<class T>
+    struct Block {
+#ifdef GMLC_UTILITIES_VECTOR_BLOCKS
+        typedef T type __attribute__((vector_size(64)));
+        static constexpr std::size_t lanes{64 / sizeof(T)};
+#else
+        using type = T;
+        static constexpr std::size_t lanes{1};
+#endif
+    };
+
+    /* each operation folds values into an accumulator with apply and merges
+    two accumulators with combine, both work on blocks and single values*/
+    struct SumOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return acc + value;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return acc1 + acc2;
+        }
+    };
+
+    struct AbsSumOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return acc + ((value < 0) ? -value : value);
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return acc1 + acc2;
+        }
+    };
+
+    struct SumSquaresOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return acc + value * value;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return acc1 + acc2;
+        }
+    };
+
+    struct ProductOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return acc * value;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return acc1 * acc2;
+        }
+    };
+
+    // a NaN fails the comparison so it never replaces the accumulator
+    struct AbsMaxOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            const V absValue = (value < 0) ? -value : value;
+            return (absValue > acc) ? absValue : acc;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return (acc2 > acc1) ? acc2 : acc1;
+        }
+    };
+
+    struct AbsMinOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            const V absValue = (value < 0) ? -value : value;
+            return (absValue < acc) ? absValue : acc;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return (acc2 < acc1) ? acc2 : acc1;
+        }
+    };
+
+    struct MinOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return (value < acc) ? value : acc;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return apply(acc1, acc2);
+        }
+    };
+
+    struct MaxOp {
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V apply(V acc, V value)
+        {
+            return (value > acc) ? value : acc;
+        }
+        template<class V>
+        GMLC_UTILITIES_ALWAYS_INLINE static V combine(V acc1, V acc2)
+        {
+            return apply(acc1, acc2);
+        }
+    };
+
+    template<class T>
+    constexpr T largestValue()
+    {
+        return std::numeric_limits<T>::has_infinity ?
+            std::numeric_limits<T>::infinity() :
+            (std::numeric_limits<T>::max)();
+    }
+    template<class T>
+    GMLC_UTILITIES_ALWAYS_INLINE typename Block<T>::type broadcast(T value)
+    {
+        typename Block<T>::type result;
+        if constexpr (Block<T>::lanes == 1) {
+            result = value;
+        } else {
+            for (std::size_t lane = 0; lane < Block<T>::lanes; ++lane) {
+                result[lane] = value;
+            }
+        }
+        return result;
+    }
+
+    template<class T>
+    GMLC_UTILITIES_ALWAYS_INLINE typename Block<T>::type load(const T* data)
+    {
+        typename Block<T>::type result;
+        std::memcpy(&result, data, sizeof(result));
+        return result;
+    }
+
+    /** combine the lanes of a block into a single value*/
+    template<class T, class Op>
+    GMLC_UTILITIES_ALWAYS_INLINE T combineLanes(typename Block<T>::type acc)
+    {
+        if constexpr (Block<T>::lanes == 1) {
+            return acc;
+        } else {
+            T result = acc[0];
+            for (std::size_t lane = 1; lane < Block<T>::lanes; ++lane) {
+                result = Op::combine(result, static_cast<T>(acc[lane]));
+            }
+            return result;
+        }
+    }
+
+    template<class T, class Op>
+    GMLC_UTILITIES_ALWAYS_INLINE T
+        reduce(const T* data, std::size_t count, T initial)
+    {
+        constexpr std::size_t lanes{Block<T>::lanes};
+        auto acc0 = broadcast(initial);
+        auto acc1 = acc0;
+        auto acc2 = acc0;
+        auto acc3 = acc0;
+        std::size_t ii{0};
+        for (; ii + 4 * lanes <= count; ii += 4 * lanes) {
+            acc0 = Op::apply(acc0, load(data + ii));
+            acc1 = Op::apply(acc1, load(data + ii + lanes));
+            acc2 = Op::apply(acc2, load(data + ii + 2 * lanes));
+            acc3 = Op::apply(acc3, load(data + ii + 3 * lanes));
+        }
+        acc0 = Op::combine(Op::combine(acc0, acc1), Op::combine(acc2, acc3));
+        T result = combineLanes<T, Op>(acc0);
+        for (; ii < count; ++ii) {
+            result = Op::apply(result, data[ii]);
+        }
+        return result;
+    }
+
+    /** the number of values summarized together, small enough that the
+    second pass over them reads the L1 cache*/
+    constexpr std::size_t summaryBlockSize{256};
+
+    /** summarize a block of values except for the location of absMax*/
+    template<class T>
+    GMLC_UTILITIES_ALWAYS_INLINE SummaryState<T>
+        summarizeBlock(const T* data, std::size_t count)
+    {
+        constexpr std::size_t lanes{Block<T>::lanes};
+        auto sum = broadcast(T(0));
+        auto smallest = broadcast(largestValue<T>());
+        auto largest = broadcast(-largestValue<T>());
+        auto absLargest = broadcast(T(0));
+        std::size_t ii{0};
+        for (; ii + lanes <= count; ii += lanes) {
+            const auto value = load(data + ii);
+            sum = SumOp::apply(sum, value);
+            smallest = MinOp::apply(smallest, value);
+            largest = MaxOp::apply(largest, value);
+            absLargest = AbsMaxOp::apply(absLargest, value);
+        }
+        SummaryState<T> state;
+        state.count = count;
+        state.sum = combineLanes<T, SumOp>(sum);
+        state.min = combineLanes<T, MinOp>(smallest);
+        state.max = combineLanes<T, MaxOp>(largest);
+        state.absMax = combineLanes<T, AbsMaxOp>(absLargest);
+        for (std::size_t jj = ii; jj < count; ++jj) {
+            state.sum = SumOp::apply(state.sum, data[jj]);
+            state.min = MinOp::apply(state.min, data[jj]);
+            state.max = MaxOp::apply(state.max, data[jj]);
+            state.absMax = AbsMaxOp::apply(state.absMax, data[jj]);
+        }
+        state.mean = state.sum / static_cast<T>(count);
+
+        // the block is in the cache for the squared deviations
+        const auto center = broadcast(state.mean);
+        auto deviations = broadcast(T(0));
+        auto squares = broadcast(T(0));
+        for (ii = 0; ii + lanes <= count; ii += lanes) {
+            const auto value = load(data + ii);
+            deviations = SumSquaresOp::apply(deviations, value - center);
+            squares = SumSquaresOp::apply(squares, value);
+        }
+        state.m2 = combineLanes<T, SumOp>(deviations);
+        state.sumSquares = combineLanes<T, SumOp>(squares);
+        for (; ii < count; ++ii) {
+            state.m2 = SumSquaresOp::apply(state.m2, data[ii] - state.mean);
+            state.sumSquares = SumSquaresOp::apply(state.sumSquares, data[ii]);
+        }
+        return state;
+    }
+
+    /** set bit ii % 64 of mask word ii / 64 when value ii compares true,
+    the plain loop over each word vectorizes to compares producing masks*/
+    template<class T, class Compare>
+    GMLC_UTILITIES_ALWAYS_INLINE std::size_t compareMask(
+        const T* data,
+        std::size_t count,
+        T value,
+        Compare compare,
+        std::uint64_t* mask)
+    {
+        std::size_t matches{0};
+        for (std::size_t start = 0; start < count; start += 64) {
+            const std::size_t length =
+                (std::min)(std::size_t{64}, count - start);
+            std::uint64_t bits{0};
+            if (length == 64) {
+                for (std::size_t bit = 0; bit < 64; ++bit) {
+                    bits |= static_cast<std::uint64_t>(
+                                compare(data[start + bit], value))
+                        << bit;
+                }
+            } else {
+                for (std::size_t bit = 0; bit < length; ++bit) {
+                    bits |= static_cast<std::uint64_t>(
+                                compare(data[start + bit], value))
+                        << bit;
+                }
+            }
+            mask[start / 64] = bits;
+            matches += static_cast<std::size_t>(std::popcount(bits));
+        }
+        return matches;
+    }
+
+    template<class T>
+    GMLC_UTILITIES_ALWAYS_INLINE std::size_t compareMask(
+        const T* data,
+        std::size_t count,
+        T value,
+        comparison_op op,
+        std::uint64_t* mask)
+    {
+        switch (op) {
+            case comparison_op::equal:
+                return compareMask(data, count, value, std::equal_to<>(), mask);
+            case comparison_op::not_equal:
+                return compareMask(
+                    data, count, value, std::not_equal_to<>(), mask);
+            case comparison_op::less:
+                return compareMask(data, count, value, std::less<>(), mask);
+            case comparison_op::less_equal:
+                return compareMask(
+                    data, count, value, std::less_equal<>(), mask);
+            case comparison_op::greater:
+                return compareMask(data, count, value, std::greater<>(), mask);
+            case comparison_op::greater_equal:
+            default:
+                return compareMask(
+                    data, count, value, std::greater_equal<>(), mask);
+        }
+    }
+
+    template<class T>
+    GMLC_UTILITIES_ALWAYS_INLINE SummaryState<T>
+        summarize(const T* data, std::size_t count)
+    {
+        SummaryState<T> state;
+        for (std::size_t start = 0; start < count; start += summaryBlockSize) {
+            const std::size_t length =
+                (std::min)(summaryBlockSize, count - start);
+            auto block = summarizeBlock(data + start, length);
+            // only a block that can change absMax is searched for it
+            if (state.count == 0 || block.absMax > state.absMax) {
+                for (std::size_t ii = 0; ii < length; ++ii) {
+                    const T value = data[start + ii];
+                    if (((value < 0) ? -value : value) == block.absMax) {
+                        block.absMaxIndex = ii;
+                        break;
+                    }
+                }
+            }
+            mergeSummary(state, block);
+        }
+        return state;
+    }
+}  // namespace
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double sumKernel(const double* data, std::size_t count)
+{
+    return reduce<double, SumOp>(data, count, 0.0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float sumKernel(const float* data, std::size_t count)
+{
+    return reduce<float, SumOp>(data, count, 0.0F);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t sumKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, SumOp>(data, count, 0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t sumKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, SumOp>(data, count, 0);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double absSumKernel(const double* data, std::size_t count)
+{
+    return reduce<double, AbsSumOp>(data, count, 0.0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float absSumKernel(const float* data, std::size_t count)
+{
+    return reduce<float, AbsSumOp>(data, count, 0.0F);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t absSumKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, AbsSumOp>(data, count, 0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t absSumKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, AbsSumOp>(data, count, 0);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double sumSquaresKernel(const double* data, std::size_t count)
+{
+    return reduce<double, SumSquaresOp>(data, count, 0.0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float sumSquaresKernel(const float* data, std::size_t count)
+{
+    return reduce<float, SumSquaresOp>(data, count, 0.0F);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t sumSquaresKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, SumSquaresOp>(data, count, 0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t sumSquaresKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, SumSquaresOp>(data, count, 0);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double productKernel(const double* data, std::size_t count)
+{
+    return reduce<double, ProductOp>(data, count, 1.0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float productKernel(const float* data, std::size_t count)
+{
+    return reduce<float, ProductOp>(data, count, 1.0F);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t productKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, ProductOp>(data, count, 1);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t productKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, ProductOp>(data, count, 1);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double absMaxKernel(const double* data, std::size_t count)
+{
+    return reduce<double, AbsMaxOp>(data, count, 0.0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float absMaxKernel(const float* data, std::size_t count)
+{
+    return reduce<float, AbsMaxOp>(data, count, 0.0F);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t absMaxKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, AbsMaxOp>(data, count, 0);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t absMaxKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, AbsMaxOp>(data, count, 0);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+double absMinKernel(const double* data, std::size_t count)
+{
+    return reduce<double, AbsMinOp>(data, count, largestValue<double>());
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+float absMinKernel(const float* data, std::size_t count)
+{
+    return reduce<float, AbsMinOp>(data, count, largestValue<float>());
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int64_t absMinKernel(const std::int64_t* data, std::size_t count)
+{
+    return reduce<std::int64_t, AbsMinOp>(
+        data, count, largestValue<std::int64_t>());
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::int32_t absMinKernel(const std::int32_t* data, std::size_t count)
+{
+    return reduce<std::int32_t, AbsMinOp>(
+        data, count, largestValue<std::int32_t>());
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+SummaryState<double> summaryKernel(const double* data, std::size_t count)
+{
+    return summarize(data, count);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+SummaryState<float> summaryKernel(const float* data, std::size_t count)
+{
+    return summarize(data, count);
+}
+
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::size_t compareMaskKernel(
+    const double* data,
+    std::size_t count,
+    double value,
+    comparison_op op,
+    std::uint64_t* mask)
+{
+    return compareMask(data, count, value, op, mask);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::size_t compareMaskKernel(
+    const float* data,
+    std::size_t count,
+    float value,
+    comparison_op op,
+    std::uint64_t* mask)
+{
+    return compareMask(data, count, value, op, mask);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::size_t compareMaskKernel(
+    const std::int64_t* data,
+    std::size_t count,
+    std::int64_t value,
+    comparison_op op,
+    std::uint64_t* mask)
+{
+    return compareMask(data, count, value, op, mask);
+}
+GMLC_UTILITIES_REDUCTION_KERNEL
+std::size_t compareMaskKernel(
+    const std::int32_t* data,
+    std::size_t count,
+    std::int32_t value,
+    comparison_op op,
+    std::uint64_t* mask)
+{
+    return compareMask(data, count, value, op, mask);
+}
+}  // namespace gmlc::utilities::vectorOpsDetail
@@ -0,0 +1,182 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/BlockingIndex.h"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace gmlc::utilities::similarity;
+
+namespace {
+const std::vector<std::string_view> names{
+    "Jonathan Smith",
+    "Mary Jones",
+    "John Smyth",
+    "Katherine O'Brien",
+    "Catherine Obrien",
+    "Robert Johnson",
+    "Rupert Jonson",
+    "Al",
+    "Alexandria Montgomery-Whitfield",
+    "jonathan smith"};
+
+bool contains(const std::vector<std::size_t>& found, std::size_t index)
+{
+    return std::find(found.begin(), found.end(), index) != found.end();
+}
+
+std::set<std::string> bigrams(std::string_view text)
+{
+    std::string padded = " ";
+    for (const char textChar : text) {
+        padded.push_back(
+            (textChar >= 'A' && textChar <= 'Z') ?
+                static_cast<char>(textChar - 'A' + 'a') :
+                textChar);
+    }
+    padded.push_back(' ');
+    std::set<std::string> grams;
+    for (std::size_t ii = 0; ii + 2 <= padded.size(); ++ii) {
+        grams.insert(padded.substr(ii, 2));
+    }
+    return grams;
+}
+}  // namespace
+
+TEST(blockingIndex, typographicalErrors)
+{
+    const BlockingIndex index(names);
+    EXPECT_EQ(index.size(), names.size());
+    const auto found = index.candidates("Jonathon Smith");
+    EXPECT_TRUE(contains(found, 0));
+    EXPECT_TRUE(contains(found, 9));
+    EXPECT_FALSE(contains(found, 1));
+    EXPECT_FALSE(contains(found, 7));
+    EXPECT_TRUE(std::is_sorted(found.begin(), found.end()));
+
+    const auto catherine = index.candidates("Kathryn O'Brian");
+    EXPECT_TRUE(contains(catherine, 3));
+    EXPECT_TRUE(contains(catherine, 4));
+}
+
+TEST(blockingIndex, phoneticKeys)
+{
+    BlockingOptions options;
+    options.qgramKeys = false;
+    options.metaphoneKeys = false;
+    const BlockingIndex soundexIndex(names, options);
+    // Smith and Smyth share the Soundex code S530
+    const auto found = soundexIndex.candidates("Jon Smith");
+    EXPECT_TRUE(contains(found, 2));
+    EXPECT_TRUE(contains(soundexIndex.candidates("Robbert Jonsen"), 5));
+
+    options.soundexKeys = false;
+    options.metaphoneKeys = true;
+    const BlockingIndex metaphoneIndex(names, options);
+    EXPECT_TRUE(contains(metaphoneIndex.candidates("Ruppert Johnsen"), 6));
+
+    // codes shared by too many entries are ignored
+    EXPECT_TRUE(contains(metaphoneIndex.candidates("Bob Smith"), 2));
+    options.maximumBlockSize = 2;
+    const BlockingIndex smallBlocks(names, options);
+    EXPECT_FALSE(contains(smallBlocks.candidates("Bob Smith"), 2));
+}
+
+TEST(blockingIndex, lengthTolerance)
+{
+    BlockingOptions options;
+    options.minimumQGramOverlap = 0.0;
+    options.lengthTolerance = 0.2;
+    const BlockingIndex index(names, options);
+    const auto found = index.candidates("Mary Jonas");
+    for (std::size_t ii = 0; ii < names.size(); ++ii) {
+        const double difference = std::abs(
+            static_cast<double>(names[ii].size()) - 10.0);
+        const double longest =
+            (std::max)(static_cast<double>(names[ii].size()), 10.0);
+        EXPECT_EQ(contains(found, ii), difference <= 0.2 * longest)
+            << names[ii];
+    }
+}
+
+TEST(blockingIndex, qgramOverlapMatchesBruteForce)
+{
+    std::mt19937 gen(3319);
+    std::uniform_int_distribution<int> letter('a', 'f');
+    std::uniform_int_distribution<std::size_t> length(0, 12);
+    std::vector<std::string> catalog(500);
+    for (auto& entry : catalog) {
+        entry.resize(length(gen));
+        for (auto& entryChar : entry) {
+            entryChar = static_cast<char>(letter(gen));
+        }
+    }
+    const std::vector<std::string_view> views(catalog.begin(), catalog.end());
+    for (const double overlap : {0.3, 0.6, 1.0}) {
+        BlockingOptions options;
+        options.qgramSize = 2;
+        options.minimumQGramOverlap = overlap;
+        options.soundexKeys = false;
+        options.metaphoneKeys = false;
+        options.lengthTolerance = 1.0;
+        const BlockingIndex index(views, options);
+        for (const std::string_view query : {"abcdef", "aaf", "", "fedcbaab"}) {
+            const auto queryGrams = bigrams(query);
+            const auto required = static_cast<std::size_t>(
+                std::ceil(overlap * static_cast<double>(queryGrams.size()) -
+                          1e-9));
+            std::vector<std::size_t> expected;
+            for (std::size_t ii = 0; ii < catalog.size(); ++ii) {
+                const auto entryGrams = bigrams(catalog[ii]);
+                std::size_t common{0};
+                for (const auto& gram : queryGrams) {
+                    common += entryGrams.count(gram);
+                }
+                if (common >= (std::max)(required, std::size_t{1})) {
+                    expected.push_back(ii);
+                }
+            }
+            EXPECT_EQ(index.candidates(query), expected)
+                << query << " " << overlap;
+        }
+    }
+}
+
+TEST(blockingIndex, candidatePairs)
+{
+    const BlockingIndex index(names);
+    const std::vector<std::string_view> queries{"Mary Jones", "Jon Smith"};
+    const auto pairs = index.candidatePairs(queries);
+    std::size_t position{0};
+    for (std::size_t query = 0; query < queries.size(); ++query) {
+        for (const auto entry : index.candidates(queries[query])) {
+            ASSERT_LT(position, pairs.size());
+            EXPECT_EQ(pairs[position].queryIndex, query);
+            EXPECT_EQ(pairs[position].catalogIndex, entry);
+            ++position;
+        }
+    }
+    EXPECT_EQ(position, pairs.size());
+}
+
+TEST(blockingIndex, invalidOptions)
+{
+    BlockingOptions options;
+    options.qgramSize = 5;
+    EXPECT_THROW(BlockingIndex(names, options), std::invalid_argument);
+    options.qgramSize = 0;
+    EXPECT_THROW(BlockingIndex(names, options), std::invalid_argument);
+}
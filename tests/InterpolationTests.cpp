@@ -0,0 +1,199 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/interpolation.hpp"
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+TEST(interpolation, linear)
+{
+    const std::vector<double> time{0.0, 1.0, 2.0, 4.0};
+    const std::vector<double> value{0.0, 10.0, 30.0, 10.0};
+    const Interpolator<double> linear(time, value);
+    EXPECT_EQ(linear.size(), 4U);
+    EXPECT_EQ(linear.method(), interpolation_method::linear);
+    const std::vector<double> timeOut{-1.0, 0.5, 1.0, 1.5, 3.0, 4.0, 5.0};
+    const std::vector<double> expected{
+        -10.0, 5.0, 10.0, 20.0, 20.0, 10.0, 0.0};
+    EXPECT_EQ(linear.evaluate(timeOut), expected);
+    EXPECT_EQ(interpolateLinear(time, value, timeOut), expected);
+    EXPECT_DOUBLE_EQ(linear(3.5), 15.0);
+
+    // unsorted times give the same values as sorted ones
+    const std::vector<double> shuffled{3.0, -1.0, 5.0, 0.5, 4.0, 1.5, 1.0};
+    const auto out = linear.evaluate(shuffled);
+    for (std::size_t ii = 0; ii < shuffled.size(); ++ii) {
+        EXPECT_DOUBLE_EQ(out[ii], linear(shuffled[ii]));
+    }
+
+    // every output before the first point
+    EXPECT_EQ(
+        interpolateLinear(time, value, std::vector<double>{-2.0, -1.0}),
+        (std::vector<double>{-20.0, -10.0}));
+    EXPECT_TRUE(
+        interpolateLinear(time, value, std::vector<double>{}).empty());
+}
+
+TEST(interpolation, stepSchemes)
+{
+    const std::vector<float> time{0.0F, 1.0F, 3.0F};
+    const std::vector<float> value{1.0F, 2.0F, 5.0F};
+    const std::vector<float> timeOut{-1.0F, 0.4F, 0.5F, 1.9F, 2.0F, 3.0F, 9.0F};
+    EXPECT_EQ(
+        interpolate(time, value, timeOut, interpolation_method::nearest),
+        (std::vector<float>{1.0F, 1.0F, 2.0F, 2.0F, 5.0F, 5.0F, 5.0F}));
+    EXPECT_EQ(
+        interpolate(time, value, timeOut, interpolation_method::previous),
+        (std::vector<float>{1.0F, 1.0F, 1.0F, 2.0F, 2.0F, 5.0F, 5.0F}));
+
+    const Interpolator<float> single(
+        std::vector<float>{2.0F}, std::vector<float>{7.0F});
+    EXPECT_EQ(single(-4.0F), 7.0F);
+    EXPECT_EQ(single(10.0F), 7.0F);
+}
+
+TEST(interpolation, cubicSchemes)
+{
+    const std::vector<double> time{0.0, 1.0, 2.0};
+    const std::vector<double> value{0.0, 1.0, 0.0};
+    // the second derivative at 1 is -3 with both ends at 0
+    const Interpolator<double> spline(
+        time, value, interpolation_method::natural_spline);
+    EXPECT_DOUBLE_EQ(spline(0.5), 0.6875);
+    EXPECT_DOUBLE_EQ(spline(1.5), 0.6875);
+    EXPECT_DOUBLE_EQ(spline(1.0), 1.0);
+    // the end slope is 2 and the slope at the extremum 0
+    const Interpolator<double> pchip(time, value, interpolation_method::pchip);
+    EXPECT_DOUBLE_EQ(pchip(0.5), 0.75);
+    EXPECT_DOUBLE_EQ(pchip(1.0), 1.0);
+
+    // both schemes reproduce a straight line
+    const std::vector<double> lineTime{0.0, 0.5, 2.0, 3.0, 7.0};
+    std::vector<double> line(lineTime.size());
+    for (std::size_t ii = 0; ii < line.size(); ++ii) {
+        line[ii] = 3.0 * lineTime[ii] - 1.0;
+    }
+    for (const auto method :
+         {interpolation_method::pchip, interpolation_method::natural_spline}) {
+        const Interpolator<double> cubic(lineTime, line, method);
+        for (const double point : {-1.0, 0.25, 1.0, 2.5, 6.0, 8.0}) {
+            EXPECT_NEAR(cubic(point), 3.0 * point - 1.0, 1e-12);
+        }
+    }
+
+    // monotone data stays monotone and within the data range with pchip
+    const std::vector<double> stepTime{0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    const std::vector<double> step{0.0, 0.0, 0.1, 5.0, 5.1, 5.1};
+    const Interpolator<double> monotone(
+        stepTime, step, interpolation_method::pchip);
+    double previous{monotone(0.0)};
+    for (double point = 0.01; point <= 5.0; point += 0.01) {
+        const double current = monotone(point);
+        EXPECT_GE(current, previous);
+        EXPECT_LE(current, 5.1);
+        previous = current;
+    }
+}
+
+TEST(interpolation, chunkedEvaluation)
+{
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> dist(-1.0, 11.0);
+    std::vector<double> time(200);
+    std::vector<double> value(200);
+    for (std::size_t ii = 0; ii < time.size(); ++ii) {
+        time[ii] = 0.05 * static_cast<double>(ii);
+        value[ii] = dist(generator);
+    }
+    std::vector<double> timeOut(3000);
+    for (auto& point : timeOut) {
+        point = dist(generator);
+    }
+    std::vector<double> sorted = timeOut;
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto method :
+         {interpolation_method::linear,
+          interpolation_method::nearest,
+          interpolation_method::previous,
+          interpolation_method::pchip,
+          interpolation_method::natural_spline}) {
+        const Interpolator<double> table(time, value, method);
+        const auto out = table.evaluate(timeOut);
+        const auto sortedOut = table.evaluate(sorted);
+        for (std::size_t ii = 0; ii < timeOut.size(); ++ii) {
+            EXPECT_EQ(out[ii], table(timeOut[ii]));
+            EXPECT_EQ(sortedOut[ii], table(sorted[ii]));
+        }
+        // the table points are reproduced
+        const auto atPoints = table.evaluate(time);
+        for (std::size_t ii = 0; ii < time.size(); ++ii) {
+            if (method != interpolation_method::nearest) {
+                EXPECT_NEAR(atPoints[ii], value[ii], 1e-12);
+            }
+        }
+    }
+}
+
+TEST(interpolation, repeatedTimes)
+{
+    // a repeated time is a step change in the linear scheme
+    const std::vector<double> time{0.0, 1.0, 1.0, 2.0};
+    const std::vector<double> value{0.0, 10.0, 1.0, 10.0};
+    const std::vector<double> timeOut{-1.0, 0.5, 1.0, 1.5, 2.0, 3.0};
+    const std::vector<double> expected{-10.0, 5.0, 10.0, 5.5, 10.0, 19.0};
+    EXPECT_EQ(interpolateLinear(time, value, timeOut), expected);
+    const Interpolator<double> linear(time, value);
+    EXPECT_EQ(linear.size(), 3U);
+    const std::vector<double> shuffled{1.5, 1.0, 3.0, -1.0, 2.0, 0.5};
+    for (const double point : shuffled) {
+        EXPECT_EQ(
+            linear(point), linear.evaluate(std::vector<double>{point})[0]);
+    }
+    EXPECT_DOUBLE_EQ(linear(1.0), 10.0);
+    EXPECT_NEAR(linear(std::nextafter(1.0, 2.0)), 1.0, 1e-12);
+
+    // steps at the ends
+    const std::vector<float> endTime{1.0F, 1.0F, 2.0F, 3.0F, 3.0F};
+    const std::vector<float> endValue{4.0F, 0.0F, 2.0F, 4.0F, 9.0F};
+    EXPECT_EQ(
+        interpolate(
+            endTime,
+            endValue,
+            std::vector<float>{0.0F, 1.0F, 2.5F, 3.0F, 4.0F}),
+        (std::vector<float>{-2.0F, 0.0F, 3.0F, 4.0F, 11.0F}));
+
+    // the other schemes still need strictly increasing times
+    EXPECT_THROW(
+        Interpolator<double>(time, value, interpolation_method::pchip),
+        std::invalid_argument);
+}
+
+TEST(interpolation, invalidTables)
+{
+    const std::vector<double> empty;
+    EXPECT_THROW(Interpolator<double>(empty, empty), std::invalid_argument);
+    const std::vector<double> repeated{0.0, 1.0, 1.0};
+    const std::vector<double> decreasing{0.0, 1.0, 0.5};
+    const std::vector<double> value{1.0, 2.0, 3.0};
+    EXPECT_THROW(
+        Interpolator<double>(
+            repeated, value, interpolation_method::natural_spline),
+        std::invalid_argument);
+    EXPECT_THROW(
+        Interpolator<double>(decreasing, value), std::invalid_argument);
+    EXPECT_THROW(
+        interpolateLinear(decreasing, value, value), std::invalid_argument);
+}
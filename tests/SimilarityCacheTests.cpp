@@ -0,0 +1,156 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/SimilarityCache.h"
+
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace gmlc::utilities::similarity;
+
+namespace {
+const std::vector<std::string_view> names{
+    "Jonathan Smith",
+    "John Smith",
+    "Jon Smyth",
+    "Jane Smith",
+    "Mary Jones",
+    "",
+    "jonathan smith"};
+
+const std::vector<similarity_metric> metrics{
+    similarity_metric::jaro_winkler,
+    similarity_metric::edit_distance,
+    similarity_metric::smith_waterman,
+    similarity_metric::alignment};
+}  // namespace
+
+TEST(similarityCache, matchesDirectComputation)
+{
+    for (const auto metric : metrics) {
+        SimilarityCache cache(100, metric);
+        for (int pass = 0; pass < 2; ++pass) {
+            for (const auto name1 : names) {
+                for (const auto name2 : names) {
+                    EXPECT_DOUBLE_EQ(
+                        cache.similarity(name1, name2),
+                        similarityScore(name1, name2, metric))
+                        << static_cast<int>(metric) << " " << name1 << ","
+                        << name2;
+                }
+            }
+        }
+        const auto stats = cache.statistics();
+        EXPECT_EQ(stats.misses, names.size() * names.size());
+        EXPECT_EQ(stats.hits, names.size() * names.size());
+        EXPECT_EQ(stats.size, names.size() * names.size());
+        EXPECT_EQ(stats.evictions, 0U);
+    }
+}
+
+TEST(similarityCache, caseSensitivity)
+{
+    SimilarityCache sensitive(
+        10, similarity_metric::edit_distance, case_sensitivity::sensitive);
+    EXPECT_DOUBLE_EQ(sensitive.similarity("Smith", "smith"), 0.8);
+    SimilarityCache insensitive(10, similarity_metric::edit_distance);
+    EXPECT_DOUBLE_EQ(insensitive.similarity("Smith", "smith"), 1.0);
+    // the strings are stored as given so the other case is a new pair
+    EXPECT_DOUBLE_EQ(insensitive.similarity("SMITH", "smith"), 1.0);
+    EXPECT_EQ(insensitive.statistics().misses, 2U);
+    EXPECT_THROW(
+        SimilarityCache(
+            10, similarity_metric::alignment, case_sensitivity::sensitive),
+        std::invalid_argument);
+}
+
+TEST(similarityCache, eviction)
+{
+    SimilarityCache cache(3);
+    cache.similarity("a", "b");
+    cache.similarity("a", "c");
+    cache.similarity("a", "d");
+    // referencing the first pair gives it a second chance
+    cache.similarity("a", "b");
+    cache.similarity("a", "e");
+    auto stats = cache.statistics();
+    EXPECT_EQ(stats.size, 3U);
+    EXPECT_EQ(stats.evictions, 1U);
+    EXPECT_EQ(stats.hits, 1U);
+
+    cache.similarity("a", "b");
+    EXPECT_EQ(cache.statistics().hits, 2U);
+    cache.similarity("a", "c");
+    EXPECT_EQ(cache.statistics().misses, 5U);
+
+    for (int ii = 0; ii < 1000; ++ii) {
+        const std::string name = std::to_string(ii);
+        EXPECT_DOUBLE_EQ(
+            cache.similarity(name, "12"), similarityScore(name, "12"));
+    }
+    stats = cache.statistics();
+    EXPECT_EQ(stats.size, 3U);
+    EXPECT_EQ(stats.evictions, 1002U);
+
+    cache.clear();
+    stats = cache.statistics();
+    EXPECT_EQ(stats.size, 0U);
+    EXPECT_EQ(stats.hits + stats.misses + stats.evictions, 0U);
+    EXPECT_DOUBLE_EQ(cache.similarity("a", "b"), similarityScore("a", "b"));
+}
+
+TEST(similarityCache, disabled)
+{
+    SimilarityCache cache(0, similarity_metric::smith_waterman);
+    EXPECT_EQ(cache.capacity(), 0U);
+    EXPECT_EQ(cache.metric(), similarity_metric::smith_waterman);
+    EXPECT_DOUBLE_EQ(
+        cache.similarity("Jon", "John"),
+        smithWatermanSimilarity("Jon", "John"));
+    cache.similarity("Jon", "John");
+    const auto stats = cache.statistics();
+    EXPECT_EQ(stats.misses, 2U);
+    EXPECT_EQ(stats.size, 0U);
+    EXPECT_THROW(
+        SimilarityCache((std::numeric_limits<std::size_t>::max)()),
+        std::invalid_argument);
+}
+
+TEST(similarityCache, concurrentLookups)
+{
+    SimilarityCache cache(20);
+    std::vector<std::thread> threads;
+    std::vector<int> errors(4, 0);
+    for (std::size_t tt = 0; tt < errors.size(); ++tt) {
+        threads.emplace_back([&cache, &errors, tt]() {
+            for (int ii = 0; ii < 2000; ++ii) {
+                const std::string name =
+                    "name" + std::to_string((ii * 7 + tt) % 30);
+                const auto other = names[ii % names.size()];
+                if (cache.similarity(name, other) !=
+                    similarityScore(name, other)) {
+                    ++errors[tt];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const int error : errors) {
+        EXPECT_EQ(error, 0);
+    }
+    const auto stats = cache.statistics();
+    EXPECT_EQ(stats.hits + stats.misses, 8000U);
+    EXPECT_LE(stats.size, 20U);
+}
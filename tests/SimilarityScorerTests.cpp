@@ -0,0 +1,219 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/SimilarityScorer.h"
+#include "gmlc/utilities/fuzzySearch.h"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace gmlc::utilities::similarity;
+
+namespace {
+const std::vector<std::string_view> names{
+    "Jonathan Smith",
+    "John Smith",
+    "Jon Smyth",
+    "Jane Smith",
+    "Johnathan Smithe",
+    "Smith Jonathan",
+    "Mary Jones",
+    "",
+    "J. Smith",
+    "jonathan smith"};
+
+std::vector<std::string> randomNames(std::size_t count, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> letter('a', 'h');
+    std::uniform_int_distribution<std::size_t> length(0, 20);
+    std::vector<std::string> result(count);
+    for (auto& name : result) {
+        name.resize(length(gen));
+        for (auto& nameChar : name) {
+            nameChar = static_cast<char>(letter(gen));
+        }
+    }
+    return result;
+}
+
+double referenceScore(
+    similarity_metric metric,
+    std::string_view query,
+    std::string_view candidate)
+{
+    switch (metric) {
+        case similarity_metric::jaro_winkler:
+            return jaroWinkler(query, candidate);
+        case similarity_metric::edit_distance: {
+            const auto longest = (std::max)(query.size(), candidate.size());
+            return (longest == 0) ? 1.0 :
+                                    1.0 -
+                    static_cast<double>(editDistance(query, candidate)) /
+                        static_cast<double>(longest);
+        }
+        case similarity_metric::smith_waterman:
+            return smithWatermanSimilarity(query, candidate);
+        case similarity_metric::alignment:
+        default:
+            return alignmentSimilarity(query, candidate);
+    }
+}
+
+const std::vector<similarity_metric> metrics{
+    similarity_metric::jaro_winkler,
+    similarity_metric::edit_distance,
+    similarity_metric::smith_waterman,
+    similarity_metric::alignment};
+}  // namespace
+
+TEST(similarityScorer, matchesSingleComparisons)
+{
+    for (const auto metric : metrics) {
+        const SimilarityScorer scorer("Jonathan SMITH", metric);
+        const auto scores = scorer.score(names);
+        ASSERT_EQ(scores.size(), names.size());
+        for (std::size_t ii = 0; ii < names.size(); ++ii) {
+            EXPECT_DOUBLE_EQ(
+                scores[ii], referenceScore(metric, "Jonathan SMITH", names[ii]))
+                << static_cast<int>(metric) << " " << names[ii];
+            EXPECT_DOUBLE_EQ(scorer.score(names[ii]), scores[ii]);
+            EXPECT_GE(scorer.scoreBound(names[ii]), scores[ii]);
+        }
+    }
+}
+
+TEST(similarityScorer, caseSensitivity)
+{
+    const SimilarityScorer scorer(
+        "Smith", similarity_metric::edit_distance, case_sensitivity::sensitive);
+    EXPECT_DOUBLE_EQ(scorer.score("Smith"), 1.0);
+    EXPECT_DOUBLE_EQ(scorer.score("smith"), 0.8);
+    const SimilarityScorer insensitive(
+        "Smith", similarity_metric::edit_distance);
+    EXPECT_DOUBLE_EQ(insensitive.score("smith"), 1.0);
+    EXPECT_EQ(insensitive.query(), "smith");
+
+    // the alignment metrics compare case insensitive character classes
+    for (const auto metric :
+         {similarity_metric::smith_waterman, similarity_metric::alignment}) {
+        EXPECT_FALSE(supportsSensitivity(metric, case_sensitivity::sensitive));
+        EXPECT_THROW(
+            SimilarityScorer("Smith", metric, case_sensitivity::sensitive),
+            std::invalid_argument);
+        EXPECT_THROW(
+            similarityScore(
+                "Smith", "smith", metric, case_sensitivity::sensitive),
+            std::invalid_argument);
+        const SimilarityScorer folded("SMITH", metric);
+        EXPECT_DOUBLE_EQ(folded.score("smith"), 1.0);
+        EXPECT_DOUBLE_EQ(
+            folded.score("Smith"), similarityScore("smith", "SMITH", metric));
+    }
+    EXPECT_TRUE(supportsSensitivity(
+        similarity_metric::jaro_winkler, case_sensitivity::sensitive));
+}
+
+TEST(similarityScorer, spanOutput)
+{
+    const SimilarityScorer scorer("john");
+    std::vector<double> scores(names.size());
+    scorer.score(names, scores);
+    EXPECT_DOUBLE_EQ(scores[1], jaroWinkler("john", names[1]));
+    std::vector<double> wrongSize(2);
+    EXPECT_THROW(scorer.score(names, wrongSize), std::invalid_argument);
+}
+
+TEST(similarityScorer, topK)
+{
+    const SimilarityScorer scorer("jonathan smith");
+    const auto best = scorer.topK(names, 3);
+    ASSERT_EQ(best.size(), 3U);
+    // the exact matches tie and are ordered by index
+    EXPECT_EQ(best[0].index, 0U);
+    EXPECT_EQ(best[1].index, 9U);
+    EXPECT_DOUBLE_EQ(best[0].score, 1.0);
+    EXPECT_GE(best[1].score, best[2].score);
+
+    EXPECT_TRUE(scorer.topK(names, 0).empty());
+    EXPECT_EQ(scorer.topK(names, 100).size(), names.size());
+    const auto good = scorer.topK(names, 100, 0.9);
+    for (const auto& result : good) {
+        EXPECT_GE(result.score, 0.9);
+    }
+}
+
+TEST(similarityScorer, topKMatchesFullSort)
+{
+    const auto catalog = randomNames(2000, 523);
+    const std::vector<std::string_view> views(catalog.begin(), catalog.end());
+    for (const auto metric : metrics) {
+        for (const auto* query : {"abcdefg", "hhh", "abcabcabcabc", ""}) {
+            const SimilarityScorer scorer(query, metric);
+            const auto scores = scorer.score(views);
+            std::vector<ScoredCandidate> expected;
+            for (std::size_t ii = 0; ii < scores.size(); ++ii) {
+                expected.push_back({ii, scores[ii]});
+            }
+            std::stable_sort(
+                expected.begin(),
+                expected.end(),
+                [](const ScoredCandidate& a, const ScoredCandidate& b) {
+                    return a.score > b.score;
+                });
+            const auto best = scorer.topK(views, 10);
+            ASSERT_EQ(best.size(), 10U);
+            for (std::size_t ii = 0; ii < best.size(); ++ii) {
+                EXPECT_EQ(best[ii].index, expected[ii].index)
+                    << static_cast<int>(metric) << " " << query;
+                EXPECT_DOUBLE_EQ(best[ii].score, expected[ii].score);
+            }
+        }
+    }
+}
+
+TEST(fuzzySearch, independentOfThreadCount)
+{
+    const auto catalog = randomNames(50000, 1784);
+    const std::vector<std::string_view> views(catalog.begin(), catalog.end());
+    for (const auto metric : metrics) {
+        const SimilarityScorer scorer("abcdefgh", metric);
+        const auto expected = scorer.topK(views, 10);
+        for (const unsigned int threads : {1U, 2U, 3U, 8U}) {
+            FuzzySearchOptions options;
+            options.threads = threads;
+            options.minimumShardSize = 1000;
+            const auto found = fuzzySearch(scorer, views, 10, options);
+            ASSERT_EQ(found.size(), expected.size());
+            for (std::size_t ii = 0; ii < found.size(); ++ii) {
+                EXPECT_EQ(found[ii].index, expected[ii].index)
+                    << static_cast<int>(metric) << " " << threads;
+                EXPECT_DOUBLE_EQ(found[ii].score, expected[ii].score);
+            }
+        }
+    }
+}
+
+TEST(fuzzySearch, queryOverload)
+{
+    FuzzySearchOptions options;
+    options.minimumScore = 0.9;
+    const auto found = fuzzySearch(
+        "JONATHAN SMITH", names, 5, similarity_metric::edit_distance, options);
+    ASSERT_EQ(found.size(), 2U);
+    EXPECT_EQ(found[0].index, 0U);
+    EXPECT_EQ(found[1].index, 9U);
+    EXPECT_TRUE(fuzzySearch("abc", names, 0).empty());
+    EXPECT_TRUE(
+        fuzzySearch("abc", std::span<const std::string_view>{}, 3).empty());
+}
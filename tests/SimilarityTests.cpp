@@ -0,0 +1,549 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/similarity.h"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace gmlc::utilities::similarity;
+
+namespace {
+std::size_t
+    referenceEditDistance(const std::string& str1, const std::string& str2)
+{
+    std::vector<std::vector<std::size_t>> table(
+        str1.size() + 1, std::vector<std::size_t>(str2.size() + 1));
+    for (std::size_t ii = 0; ii <= str1.size(); ++ii) {
+        table[ii][0] = ii;
+    }
+    for (std::size_t jj = 0; jj <= str2.size(); ++jj) {
+        table[0][jj] = jj;
+    }
+    for (std::size_t ii = 1; ii <= str1.size(); ++ii) {
+        for (std::size_t jj = 1; jj <= str2.size(); ++jj) {
+            table[ii][jj] = (std::min)(
+                {table[ii - 1][jj] + 1,
+                 table[ii][jj - 1] + 1,
+                 table[ii - 1][jj - 1] +
+                     ((str1[ii - 1] == str2[jj - 1]) ? 0U : 1U)});
+        }
+    }
+    return table[str1.size()][str2.size()];
+}
+
+// scan the whole match window for each character
+double referenceJaroWinkler(const std::string& str1, const std::string& str2)
+{
+    if (str1.empty() || str2.empty()) {
+        return (str1.empty() && str2.empty()) ? 1.0 : 0.0;
+    }
+    const std::size_t longest = (std::max)(str1.size(), str2.size());
+    const std::size_t window = (longest >= 2U) ? longest / 2U - 1U : 0U;
+    std::vector<bool> matched1(str1.size(), false);
+    std::vector<bool> matched2(str2.size(), false);
+    std::size_t matches{0};
+    for (std::size_t ii = 0; ii < str1.size(); ++ii) {
+        const std::size_t start = (ii > window) ? ii - window : 0U;
+        const std::size_t end = (std::min)(ii + window + 1, str2.size());
+        for (std::size_t jj = start; jj < end; ++jj) {
+            if (!matched2[jj] && str1[ii] == str2[jj]) {
+                matched1[ii] = true;
+                matched2[jj] = true;
+                ++matches;
+                break;
+            }
+        }
+    }
+    if (matches == 0) {
+        return 0.0;
+    }
+    std::size_t transpositions{0};
+    std::size_t kk{0};
+    for (std::size_t ii = 0; ii < str1.size(); ++ii) {
+        if (matched1[ii]) {
+            while (!matched2[kk]) {
+                ++kk;
+            }
+            transpositions += (str1[ii] != str2[kk]) ? 1U : 0U;
+            ++kk;
+        }
+    }
+    const auto common = static_cast<double>(matches);
+    const double jaro = (common / static_cast<double>(str1.size()) +
+                         common / static_cast<double>(str2.size()) +
+                         (common - static_cast<double>(transpositions / 2)) /
+                             common) /
+        3.0;
+    std::size_t prefix{0};
+    while (prefix < (std::min)({std::size_t{4}, str1.size(), str2.size()}) &&
+           str1[prefix] == str2[prefix]) {
+        ++prefix;
+    }
+    return jaro + static_cast<double>(prefix) * 0.1 * (1.0 - jaro);
+}
+
+std::string randomString(std::mt19937& gen, std::size_t length)
+{
+    std::uniform_int_distribution<int> letter('a', 'd');
+    std::string result(length, ' ');
+    for (auto& stringChar : result) {
+        stringChar = static_cast<char>(letter(gen));
+    }
+    return result;
+}
+}  // namespace
+
+TEST(similarity, strIeq)
+{
+    EXPECT_TRUE(strIeq("Hello World", "hELLO wORLD"));
+    EXPECT_TRUE(strIeq("", ""));
+    EXPECT_FALSE(strIeq("abc", "abcd"));
+    EXPECT_FALSE(strIeq("a[c", "a{c"));
+    EXPECT_FALSE(strIeq("@", "`"));
+}
+
+TEST(similarity, characterClass)
+{
+    static_assert(characterClass('a') == 0);
+    static_assert(characterClass('Z') == 25);
+    static_assert(characterClass(' ') == spaceCharacterClass);
+    static_assert(characterClass('7') == otherCharacterClass);
+    static_assert(substitutionScore('q', 'Q') == matchScore);
+    static_assert(substitutionScore('q', 'r') == mismatchScore);
+}
+
+namespace {
+// score c/k and s/z as partial matches
+constexpr SubstitutionMatrix phoneticMatrix = [] {
+    auto matrix = makeSubstitutionMatrix(matchScore, mismatchScore);
+    const std::array<std::pair<char, char>, 2> pairs{
+        {{'c', 'k'}, {'s', 'z'}}};
+    for (const auto& [char1, char2] : pairs) {
+        matrix[characterClass(char1)][characterClass(char2)] = 0.5F;
+        matrix[characterClass(char2)][characterClass(char1)] = 0.5F;
+    }
+    return matrix;
+}();
+}  // namespace
+
+TEST(similarity, substitutionMatrix)
+{
+    static_assert(defaultSubstitutionMatrix[3][3] == matchScore);
+    static_assert(defaultSubstitutionMatrix[3][4] == mismatchScore);
+    static_assert(substitutionScore<phoneticMatrix>('C', 'k') == 0.5F);
+    static_assert(substitutionScore<phoneticMatrix>('c', 'c') == matchScore);
+
+    EXPECT_FLOAT_EQ(smithWatermanScore("kat", "cat"), 2.0F);
+    EXPECT_FLOAT_EQ(smithWatermanScore<phoneticMatrix>("kat", "cat"), 2.5F);
+    EXPECT_GT(
+        smithWatermanSimilarity<phoneticMatrix>("catz", "kats"),
+        smithWatermanSimilarity("catz", "kats"));
+    EXPECT_GT(
+        alignmentSimilarity("kristina", "christina", phoneticMatrix),
+        alignmentSimilarity("kristina", "christina"));
+    EXPECT_EQ(
+        alignmentSimilarity<phoneticMatrix>("kristina", "christina"),
+        alignmentSimilarity("kristina", "christina", phoneticMatrix));
+
+    const SmithWatermanProfile profile("kristina", phoneticMatrix);
+    for (const auto* text : {"christina", "cristine", "kris", "zzz"}) {
+        EXPECT_EQ(
+            profile.score(text),
+            smithWatermanScore<phoneticMatrix>("kristina", text));
+    }
+}
+
+namespace {
+// the default scores doubled
+constexpr SubstitutionMatrix doubledMatrix{
+    makeSubstitutionMatrix(2.0F * matchScore, 2.0F * mismatchScore)};
+}  // namespace
+
+TEST(similarity, scaledSubstitutionMatrix)
+{
+    static_assert(largestMatchScore(doubledMatrix) == 2.0F * matchScore);
+    // the scores scale with the matrix but the similarities without gaps do
+    // not
+    EXPECT_FLOAT_EQ(smithWatermanScore<doubledMatrix>("abcd", "abcd"), 8.0F);
+    EXPECT_DOUBLE_EQ(
+        smithWatermanSimilarity<doubledMatrix>("abcd", "abcd"), 1.0);
+    EXPECT_DOUBLE_EQ(
+        smithWatermanSimilarity<doubledMatrix>("abcde", "abxde"),
+        smithWatermanSimilarity("abcde", "abxde"));
+    const SmithWatermanProfile profile("abcd", doubledMatrix);
+    EXPECT_DOUBLE_EQ(profile.similarity("abcd"), 1.0);
+    EXPECT_DOUBLE_EQ(
+        profile.similarity("xxabxd"),
+        smithWatermanSimilarity("abcd", "xxabxd"));
+
+    const double similarity =
+        alignmentSimilarity("abcd", "abce", doubledMatrix);
+    EXPECT_LE(similarity, 1.0);
+    EXPECT_NEAR(similarity, alignmentSimilarity("abcd", "abce"), 1e-12);
+    // the gap penalties do not scale so alignments with gaps differ, the
+    // bound must be applied to the scaled score
+    const double gapped =
+        alignmentSimilarity("kristina", "christina", doubledMatrix);
+    EXPECT_LE(gapped, 1.0);
+    EXPECT_DOUBLE_EQ(
+        boundedAlignmentSimilarity(
+            "kristina", "christina", gapped, fullBand, doubledMatrix),
+        gapped);
+    EXPECT_DOUBLE_EQ(
+        boundedAlignmentSimilarity(
+            "kristina", "christina", gapped + 0.01, fullBand, doubledMatrix),
+        0.0);
+    EXPECT_EQ(
+        boundedAlignmentSimilarity<doubledMatrix>(
+            "kristina", "christina", gapped),
+        gapped);
+    EXPECT_EQ(
+        boundedAlignmentSimilarity<doubledMatrix>(
+            "kristina", "christina", gapped + 0.01),
+        0.0);
+}
+
+TEST(similarity, soundex)
+{
+    EXPECT_EQ(soundex("Robert"), "R163");
+    EXPECT_EQ(soundex("rupert"), "R163");
+    EXPECT_EQ(soundex("Rubin"), "R150");
+    EXPECT_EQ(soundex("Ashcraft"), "A261");
+    EXPECT_EQ(soundex("Tymczak"), "T522");
+    EXPECT_EQ(soundex("Pfister"), "P236");
+    EXPECT_EQ(soundex("Honeyman"), "H555");
+    EXPECT_EQ(soundex("O'Brien"), "O165");
+    EXPECT_EQ(soundex("Lee"), "L000");
+    EXPECT_EQ(soundex("123"), "");
+}
+
+TEST(similarity, metaphone)
+{
+    EXPECT_EQ(metaphone("Smith"), "SM0");
+    EXPECT_EQ(metaphone("Knight"), "NT");
+    EXPECT_EQ(metaphone("Wright"), "RT");
+    EXPECT_EQ(metaphone("Philip"), "FLP");
+    EXPECT_EQ(metaphone("Xavier"), "SFR");
+    EXPECT_EQ(metaphone("Whitfield"), "WTFLT");
+    EXPECT_EQ(metaphone("Catherine"), metaphone("Kathryn"));
+    EXPECT_EQ(metaphone("Schmidt"), "SKMTT");
+    EXPECT_EQ(metaphone("Thumb"), "0M");
+    EXPECT_EQ(metaphone("George"), "JRJ");
+    EXPECT_EQ(metaphone("Alexander", 4), "ALKS");
+    EXPECT_EQ(metaphone(""), "");
+}
+
+TEST(similarity, editDistance)
+{
+    EXPECT_EQ(editDistance("kitten", "sitting"), 3U);
+    EXPECT_EQ(editDistance("sitting", "kitten"), 3U);
+    EXPECT_EQ(editDistance("Saturday", "sunday"), 3U);
+    EXPECT_EQ(editDistance("", "abc"), 3U);
+    EXPECT_EQ(editDistance("abc", ""), 3U);
+    EXPECT_EQ(editDistance("ABC", "abc"), 0U);
+    EXPECT_EQ(editDistance("flaw", "lawn"), 2U);
+
+    // no truncation of long strings
+    const std::string long1(100, 'a');
+    std::string long2 = long1;
+    long2.back() = 'b';
+    EXPECT_EQ(editDistance(long1, long2), 1U);
+    EXPECT_EQ(editDistance(long1, long1 + "bcd"), 3U);
+}
+
+TEST(similarity, editDistanceCase)
+{
+    EXPECT_EQ(editDistance("ABC", "abc", case_sensitivity::sensitive), 3U);
+    EXPECT_EQ(editDistance("AbC", "abc", case_sensitivity::sensitive), 2U);
+    EXPECT_EQ(editDistance("a[c", "A{C"), 1U);
+
+    const std::string upper(130, 'Q');
+    const std::string lower(130, 'q');
+    EXPECT_EQ(editDistance(upper, lower), 0U);
+    EXPECT_EQ(editDistance(upper, lower, case_sensitivity::sensitive), 130U);
+}
+
+TEST(similarity, editDistanceRandom)
+{
+    std::mt19937 gen(2481);
+    // cover single word patterns and multiple blocks with partial last words
+    const std::vector<std::size_t> lengths{
+        1, 2, 7, 31, 63, 64, 65, 100, 127, 128, 129, 200};
+    for (const auto length1 : lengths) {
+        for (const auto length2 : lengths) {
+            const auto str1 = randomString(gen, length1);
+            const auto str2 = randomString(gen, length2);
+            EXPECT_EQ(
+                editDistance(str1, str2), referenceEditDistance(str1, str2))
+                << length1 << " " << length2;
+        }
+    }
+}
+
+TEST(similarity, boundedEditDistance)
+{
+    EXPECT_EQ(boundedEditDistance("kitten", "sitting", 3), 3U);
+    EXPECT_EQ(boundedEditDistance("kitten", "sitting", 2), 3U);
+    EXPECT_EQ(boundedEditDistance("kitten", "sitting", 0), 1U);
+    EXPECT_EQ(boundedEditDistance("abc", "abcdefgh", 2), 3U);
+    EXPECT_EQ(boundedEditDistance("", "abc", 5), 3U);
+
+    std::mt19937 gen(97);
+    for (const std::size_t length : {20U, 90U, 150U}) {
+        for (int trial = 0; trial < 20; ++trial) {
+            const auto str1 = randomString(gen, length);
+            const auto str2 = randomString(gen, length + 3);
+            const auto distance = referenceEditDistance(str1, str2);
+            for (const std::size_t bound : {0U, 3U, 10U, 40U, 200U}) {
+                EXPECT_EQ(
+                    boundedEditDistance(str1, str2, bound),
+                    (std::min)(distance, bound + 1));
+            }
+        }
+    }
+}
+
+TEST(similarity, jaroWinkler)
+{
+    EXPECT_NEAR(jaroWinkler("MARTHA", "MARHTA"), 0.961111, 1e-6);
+    EXPECT_NEAR(jaroWinkler("martha", "MARHTA"), 0.961111, 1e-6);
+    EXPECT_NEAR(jaroWinkler("DWAYNE", "DUANE"), 0.84, 1e-6);
+    EXPECT_NEAR(jaroWinkler("DIXON", "DICKSONX"), 0.813333, 1e-6);
+    EXPECT_NEAR(jaroWinkler("DICKSONX", "DIXON"), 0.813333, 1e-6);
+    EXPECT_DOUBLE_EQ(jaroWinkler("abc", "xyz"), 0.0);
+    EXPECT_DOUBLE_EQ(jaroWinkler("same", "SAME"), 1.0);
+    EXPECT_DOUBLE_EQ(jaroWinkler("", ""), 1.0);
+    EXPECT_DOUBLE_EQ(jaroWinkler("", "a"), 0.0);
+    EXPECT_DOUBLE_EQ(jaroWinkler("a", "a"), 1.0);
+
+    // differences beyond 25 characters are not ignored
+    const std::string long1 = "abcdefghijklmnopqrstuvwxyz0123456789";
+    std::string long2 = long1;
+    long2[30] = '#';
+    const double score = jaroWinkler(long1, long2);
+    EXPECT_LT(score, 1.0);
+    EXPECT_GT(score, 0.95);
+}
+
+TEST(similarity, jaroWinklerCase)
+{
+    EXPECT_DOUBLE_EQ(
+        jaroWinkler("same", "SAME", case_sensitivity::sensitive), 0.0);
+    EXPECT_DOUBLE_EQ(
+        jaroWinkler("same", "same", case_sensitivity::sensitive), 1.0);
+    EXPECT_NEAR(
+        jaroWinkler("MARTHA", "MARHTA", case_sensitivity::sensitive),
+        0.961111,
+        1e-6);
+    EXPECT_LT(
+        jaroWinkler("Martha", "mARHTA", case_sensitivity::sensitive),
+        jaroWinkler("Martha", "mARHTA"));
+}
+
+TEST(similarity, jaroWinklerLong)
+{
+    // strings spanning several mask words with a wide match window
+    std::mt19937 gen(8843);
+    const std::string long1 = randomString(gen, 300);
+    std::string long2 = long1;
+    std::swap(long2[10], long2[11]);
+    std::swap(long2[150], long2[250]);
+    long2.erase(70, 3);
+    const double score = jaroWinkler(long1, long2);
+    EXPECT_LT(score, 1.0);
+    EXPECT_GT(score, 0.9);
+    EXPECT_DOUBLE_EQ(jaroWinkler(long2, long1), score);
+    EXPECT_DOUBLE_EQ(score, referenceJaroWinkler(long1, long2));
+    EXPECT_DOUBLE_EQ(jaroWinkler(long1, long1), 1.0);
+}
+
+TEST(similarity, jaroWinklerPattern)
+{
+    std::mt19937 gen(1290);
+    const std::vector<std::size_t> lengths{1, 3, 10, 63, 64, 65, 130, 200};
+    std::vector<std::string> texts;
+    for (const auto length : lengths) {
+        texts.push_back(randomString(gen, length));
+    }
+    texts.emplace_back();
+    const std::vector<std::string_view> views(texts.begin(), texts.end());
+    for (const auto& query : texts) {
+        const JaroWinklerPattern pattern(query);
+        EXPECT_EQ(pattern.size(), query.size());
+        const auto scores = pattern.similarity(views);
+        ASSERT_EQ(scores.size(), views.size());
+        for (std::size_t ii = 0; ii < views.size(); ++ii) {
+            EXPECT_DOUBLE_EQ(pattern.similarity(views[ii]), scores[ii]);
+            EXPECT_DOUBLE_EQ(jaroWinkler(query, views[ii]), scores[ii]);
+            EXPECT_DOUBLE_EQ(
+                referenceJaroWinkler(query, texts[ii]), scores[ii]);
+        }
+    }
+    const JaroWinklerPattern sensitive("Martha", case_sensitivity::sensitive);
+    EXPECT_DOUBLE_EQ(
+        sensitive.similarity("marhta"),
+        jaroWinkler("Martha", "marhta", case_sensitivity::sensitive));
+    std::vector<double> wrongSize(1);
+    EXPECT_THROW(sensitive.similarity(views, wrongSize), std::invalid_argument);
+}
+
+TEST(similarity, smithWaterman)
+{
+    EXPECT_FLOAT_EQ(smithWatermanScore("abc", "xxabcxx"), 3.0F);
+    EXPECT_FLOAT_EQ(smithWatermanScore("xxabcxx", "ABC"), 3.0F);
+    EXPECT_FLOAT_EQ(smithWatermanScore("abc", "xyz"), 0.0F);
+    // a mismatch inside the alignment
+    EXPECT_FLOAT_EQ(smithWatermanScore("abcde", "abxde"), 3.6F);
+    // a gap inside the alignment
+    EXPECT_FLOAT_EQ(smithWatermanScore("abcdef", "abcxdef"), 5.6F);
+    EXPECT_FLOAT_EQ(smithWatermanScore("", "abc"), 0.0F);
+
+    EXPECT_DOUBLE_EQ(smithWatermanSimilarity("john smith", "smith"), 1.0);
+    EXPECT_NEAR(smithWatermanSimilarity("abcde", "abxde"), 0.72, 1e-6);
+    EXPECT_DOUBLE_EQ(smithWatermanSimilarity("", "abc"), 0.0);
+
+    const std::string long1(200, 'g');
+    EXPECT_FLOAT_EQ(smithWatermanScore(long1, long1), 200.0F);
+}
+
+TEST(similarity, alignmentSimilarity)
+{
+    EXPECT_DOUBLE_EQ(alignmentSimilarity("Robert", "ROBERT"), 1.0);
+    EXPECT_DOUBLE_EQ(alignmentSimilarity("", "abc"), 0.0);
+    EXPECT_DOUBLE_EQ(alignmentSimilarity("abc", "xyz"), 0.0);
+    EXPECT_NEAR(alignmentSimilarity("ab", "cb"), 0.3, 1e-6);
+
+    // a transposed pair scores as a single match
+    EXPECT_DOUBLE_EQ(alignmentSimilarity("abdc", "abcd"), 0.75);
+    EXPECT_LT(alignmentSimilarity("abxy", "abcd"), 0.75);
+    const double close = alignmentSimilarity("jonathan", "johnathan");
+    const double far = alignmentSimilarity("jonathan", "elizabeth");
+    EXPECT_GT(close, 0.7);
+    EXPECT_LT(far, close);
+
+    const std::string long1(150, 'x');
+    EXPECT_NEAR(alignmentSimilarity(long1, long1 + "y"), 149.6 / 151.0, 1e-6);
+}
+
+TEST(similarity, boundedAlignmentSimilarity)
+{
+    EXPECT_DOUBLE_EQ(boundedAlignmentSimilarity("Robert", "ROBERT", 0.9), 1.0);
+    EXPECT_DOUBLE_EQ(boundedAlignmentSimilarity("abc", "abcdefghij", 0.5), 0.0);
+    EXPECT_DOUBLE_EQ(boundedAlignmentSimilarity("", "abc", 0.0), 0.0);
+
+    std::mt19937 gen(4411);
+    const std::vector<std::size_t> lengths{1, 2, 5, 12, 40, 90};
+    for (const auto length1 : lengths) {
+        for (const auto length2 : lengths) {
+            const auto str1 = randomString(gen, length1);
+            const auto str2 = randomString(gen, length2);
+            const double full = alignmentSimilarity(str1, str2);
+            for (const double minimum : {0.0, 0.1, 0.3, 0.5, 0.9}) {
+                // early termination never rejects a string that qualifies
+                EXPECT_DOUBLE_EQ(
+                    boundedAlignmentSimilarity(str1, str2, minimum),
+                    (full >= minimum) ? full : 0.0)
+                    << str1 << " " << str2 << " " << minimum;
+            }
+            // a band covering the whole table is exact
+            EXPECT_DOUBLE_EQ(
+                boundedAlignmentSimilarity(str1, str2, 0.0, 90), full);
+        }
+    }
+}
+
+TEST(similarity, bandedAlignmentSimilarity)
+{
+    // strings aligning along the diagonal are unaffected by a narrow band
+    const std::vector<std::pair<std::string, std::string>> pairs{
+        {"jonathan smith", "johnathan smyth"},
+        {"kristina", "christina"},
+        {"abdc", "abcd"},
+        {"elizabeth", "jonathan"},
+        {"a", "abcdefgh"}};
+    for (const auto& [str1, str2] : pairs) {
+        EXPECT_DOUBLE_EQ(
+            boundedAlignmentSimilarity(str1, str2, 0.0, 2),
+            alignmentSimilarity(str1, str2))
+            << str1 << " " << str2;
+    }
+    const std::string long1(300, 'x');
+    const std::string long2 = long1 + "yy";
+    EXPECT_DOUBLE_EQ(
+        boundedAlignmentSimilarity(long1, long2, 0.0, 4),
+        alignmentSimilarity(long1, long2));
+}
+
+TEST(similarity, smithWatermanProfile)
+{
+    const SmithWatermanProfile profile("Jonathan Smith");
+    for (const auto* text : {"jon smith", "smithers", "", "JONATHAN SMITH"}) {
+        EXPECT_FLOAT_EQ(
+            profile.score(text), smithWatermanScore("Jonathan Smith", text));
+        EXPECT_DOUBLE_EQ(
+            profile.similarity(text),
+            smithWatermanSimilarity("Jonathan Smith", text));
+    }
+}
+
+TEST(similarity, smithWatermanProfileRandom)
+{
+    std::mt19937 gen(1522);
+    // cover queries shorter than, equal to and not a multiple of the lanes
+    const std::vector<std::size_t> lengths{1, 2, 3, 4, 5, 9, 16, 33, 70, 130};
+    for (const auto queryLength : lengths) {
+        const auto query = randomString(gen, queryLength);
+        const SmithWatermanProfile profile(query);
+        for (const auto textLength : lengths) {
+            const auto text = randomString(gen, textLength);
+            // the same operations are performed so the scores are exact
+            EXPECT_EQ(profile.score(text), smithWatermanScore(query, text))
+                << query << " " << text;
+        }
+    }
+}
+
+TEST(similarity, smithWatermanProfileBatch)
+{
+    const SmithWatermanProfile profile("abcabc");
+    const std::vector<std::string_view> texts{"abc", "", "xxabcabcxx", "cba"};
+    const auto scores = profile.score(texts);
+    ASSERT_EQ(scores.size(), texts.size());
+    for (std::size_t ii = 0; ii < texts.size(); ++ii) {
+        EXPECT_EQ(scores[ii], smithWatermanScore("abcabc", texts[ii]));
+    }
+    std::vector<float> wrongSize(1);
+    EXPECT_THROW(profile.score(texts, wrongSize), std::invalid_argument);
+}
+
+TEST(similarity, editDistancePattern)
+{
+    const EditDistancePattern shortPattern("Kitten");
+    EXPECT_EQ(shortPattern.size(), 6U);
+    EXPECT_EQ(shortPattern.distance("sitting"), 3U);
+    EXPECT_EQ(shortPattern.distance("sitting", 1), 2U);
+    EXPECT_EQ(shortPattern.distance(""), 6U);
+
+    std::mt19937 gen(31);
+    const auto longString = randomString(gen, 150);
+    const EditDistancePattern longPattern(longString);
+    for (const std::size_t length : {0U, 10U, 140U, 150U, 300U}) {
+        const auto text = randomString(gen, length);
+        EXPECT_EQ(
+            longPattern.distance(text),
+            referenceEditDistance(longString, text));
+    }
+}
@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/smallSolvers.hpp"
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include "gtest/gtest.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+TEST(smallSolvers, singleSystem)
+{
+    const std::array<std::array<double, 3>, 3> input{
+        {{2.0, 1.0, -1.0}, {-3.0, -1.0, 2.0}, {-2.0, 1.0, 2.0}}};
+    const std::array<double, 3> vals{8.0, -11.0, -3.0};
+    auto result = solveNxN<3>(input, vals);
+    EXPECT_EQ(result.status, solve_status::ok);
+    const auto expected = solve3x3(input, vals);
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        EXPECT_NEAR(result.values[ii], expected[ii], 1e-12);
+    }
+    EXPECT_NEAR(result.values[0], 2.0, 1e-12);
+    EXPECT_NEAR(result.values[1], 3.0, 1e-12);
+    EXPECT_NEAR(result.values[2], -1.0, 1e-12);
+
+    // a zero leading entry needs a row swap
+    auto swapped = solveNxN<2>(
+        std::array<std::array<double, 2>, 2>{{{0.0, 2.0}, {3.0, 1.0}}},
+        std::array<double, 2>{4.0, 5.0});
+    double x1{0.0};
+    double x2{0.0};
+    solve2x2(0.0, 2.0, 3.0, 1.0, 4.0, 5.0, x1, x2);
+    EXPECT_EQ(swapped.status, solve_status::ok);
+    EXPECT_NEAR(swapped.values[0], x1, 1e-14);
+    EXPECT_NEAR(swapped.values[1], x2, 1e-14);
+}
+
+TEST(smallSolvers, conditionAndSingular)
+{
+    // diag(1, 1e-3) has a 1-norm condition number of 1000
+    auto scaled = solveNxN<2>(
+        std::array<std::array<double, 2>, 2>{{{1.0, 0.0}, {0.0, 1e-3}}},
+        std::array<double, 2>{1.0, 1.0});
+    EXPECT_EQ(scaled.status, solve_status::ok);
+    EXPECT_NEAR(scaled.condition, 1000.0, 1e-9);
+    EXPECT_NEAR(scaled.values[1], 1000.0, 1e-9);
+
+    auto singular = solveNxN<3>(
+        std::array<std::array<double, 3>, 3>{
+            {{1.0, 2.0, 3.0}, {2.0, 4.0, 6.0}, {1.0, 0.0, 1.0}}},
+        std::array<double, 3>{1.0, 2.0, 3.0});
+    EXPECT_EQ(singular.status, solve_status::singular);
+    EXPECT_TRUE(std::isinf(singular.condition));
+
+    auto single = solveNxN<2, float>(
+        std::array<std::array<float, 2>, 2>{{{4.0F, 1.0F}, {2.0F, 3.0F}}},
+        std::array<float, 2>{1.0F, 2.0F});
+    EXPECT_EQ(single.status, solve_status::ok);
+    EXPECT_NEAR(single.values[0], 0.1F, 1e-6F);
+    EXPECT_NEAR(single.values[1], 0.6F, 1e-6F);
+}
+
+template<std::size_t N>
+void checkBatch(std::size_t count)
+{
+    std::mt19937 generator(static_cast<unsigned>(N * 31 + count));
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> matrices(N * N * count);
+    std::vector<double> rhs(N * count);
+    for (auto& value : matrices) {
+        value = dist(generator);
+    }
+    for (auto& value : rhs) {
+        value = dist(generator);
+    }
+    // make system 1 singular by repeating its first row
+    if (count > 1) {
+        for (std::size_t col = 0; col < N; ++col) {
+            matrices[(N + col) * count + 1] = matrices[col * count + 1];
+        }
+    }
+    std::vector<double> solutions(N * count);
+    std::vector<solve_status> status(count);
+    std::vector<double> conditions(count);
+    const auto singular = solveNxN<N, double>(
+        matrices, rhs, solutions, status, conditions);
+    EXPECT_EQ(singular, (count > 1) ? 1U : 0U);
+
+    for (std::size_t sys = 0; sys < count; ++sys) {
+        std::array<std::array<double, N>, N> input{};
+        std::array<double, N> vals{};
+        for (std::size_t row = 0; row < N; ++row) {
+            for (std::size_t col = 0; col < N; ++col) {
+                input[row][col] = matrices[(row * N + col) * count + sys];
+            }
+            vals[row] = rhs[row * count + sys];
+        }
+        const auto expected = solveNxN<N>(input, vals);
+        EXPECT_EQ(status[sys], expected.status) << "system " << sys;
+        if (sys == 1) {
+            EXPECT_EQ(status[sys], solve_status::singular);
+            EXPECT_TRUE(std::isinf(conditions[sys]));
+            continue;
+        }
+        EXPECT_NEAR(
+            conditions[sys], expected.condition, 1e-12 * expected.condition);
+        for (std::size_t row = 0; row < N; ++row) {
+            // the residual of the solution
+            double residual = -vals[row];
+            for (std::size_t col = 0; col < N; ++col) {
+                residual += input[row][col] * solutions[col * count + sys];
+            }
+            EXPECT_NEAR(residual, 0.0, 1e-9 * expected.condition);
+            EXPECT_NEAR(
+                solutions[row * count + sys],
+                expected.values[row],
+                1e-12 * expected.condition);
+        }
+    }
+}
+
+TEST(smallSolvers, batches)
+{
+    checkBatch<2>(37);
+    checkBatch<3>(16);
+    checkBatch<4>(100);
+    checkBatch<5>(1);
+    checkBatch<8>(45);
+
+    // the solutions alone without status or condition numbers
+    const std::vector<float> matrices{4.0F, 1.0F, 1.0F, 1.0F, 2.0F, 1.0F,
+                                      3.0F, 2.0F};
+    const std::vector<float> rhs{1.0F, 3.0F, 2.0F, 5.0F};
+    std::vector<float> solutions(4);
+    EXPECT_EQ((solveNxN<2, float>(matrices, rhs, solutions)), 0U);
+    EXPECT_NEAR(solutions[0], 0.1F, 1e-6F);
+    EXPECT_NEAR(solutions[2], 0.6F, 1e-6F);
+    EXPECT_NEAR(solutions[1], 1.0F, 1e-6F);
+    EXPECT_NEAR(solutions[3], 2.0F, 1e-6F);
+
+    std::vector<float> wrong(3);
+    EXPECT_THROW(
+        (solveNxN<2, float>(matrices, rhs, wrong)), std::invalid_argument);
+}
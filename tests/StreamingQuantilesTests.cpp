@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/streamingQuantiles.hpp"
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+TEST(streamingQuantiles, runningMedian)
+{
+    RunningMedian<double> running;
+    EXPECT_EQ(running.median(), 0.0);
+    std::mt19937 gen(45);
+    std::uniform_int_distribution<int> dist(-50, 50);
+    std::vector<double> seen;
+    for (int ii = 0; ii < 301; ++ii) {
+        const double value = dist(gen);
+        running.add(value);
+        seen.push_back(value);
+        ASSERT_EQ(running.median(), median(seen)) << "after " << seen.size();
+    }
+    EXPECT_EQ(running.count(), seen.size());
+    running.clear();
+    EXPECT_EQ(running.count(), 0U);
+}
+
+TEST(streamingQuantiles, p2Quantile)
+{
+    EXPECT_THROW(P2Quantile<double>(1.5), std::invalid_argument);
+
+    P2Quantile<double> few(0.5);
+    for (double value : {5.0, 1.0, 3.0, 2.0}) {
+        few.add(value);
+    }
+    EXPECT_EQ(few.value(), 2.5);
+
+    std::mt19937 gen(46);
+    std::normal_distribution<double> dist(10.0, 2.0);
+    P2Quantile<double> medianEstimate;
+    P2Quantile<double> upperEstimate(0.9);
+    std::vector<double> data(20000);
+    for (auto& value : data) {
+        value = dist(gen);
+        medianEstimate.add(value);
+        upperEstimate.add(value);
+    }
+    EXPECT_EQ(medianEstimate.count(), data.size());
+    EXPECT_NEAR(medianEstimate.value(), quantile(data, 0.5), 0.05);
+    EXPECT_NEAR(upperEstimate.value(), quantile(data, 0.9), 0.05);
+}
+
+TEST(streamingQuantiles, slidingWindowMedian)
+{
+    EXPECT_THROW(SlidingWindowMedian<int>(0), std::invalid_argument);
+
+    constexpr std::size_t window{7};
+    SlidingWindowMedian<double> sliding(window);
+    EXPECT_EQ(sliding.windowSize(), window);
+    std::mt19937 gen(47);
+    std::uniform_int_distribution<int> dist(0, 20);
+    std::vector<double> data(500);
+    for (std::size_t ii = 0; ii < data.size(); ++ii) {
+        data[ii] = dist(gen);
+        const double result = sliding.add(data[ii]);
+        const std::size_t first = (ii + 1 > window) ? ii + 1 - window : 0;
+        const std::span<const double> current(
+            data.data() + first, ii + 1 - first);
+        ASSERT_EQ(result, median(current)) << "at " << ii;
+    }
+    EXPECT_EQ(sliding.size(), window);
+    sliding.clear();
+    EXPECT_EQ(sliding.size(), 0U);
+    EXPECT_EQ(sliding.add(4.0), 4.0);
+}
@@ -14,7 +14,9 @@
 #include "gmlc/utilities/stringOps.h"
 
 #include "gtest/gtest.h"
+#include <clocale>
 #include <cstdint>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -176,3 +178,76 @@ TEST(stringconversion, simple_floating_point_conversionsComplete_test)
     auto h = numeric_conversionComplete("-FF3q45", 18.7);
     EXPECT_NEAR(h, 18.7, closeDef);
 }
+
+TEST(stringconversion, try_numeric_conversion_test)
+{
+    const std::string input("  -7629  ");
+    auto a = tryNumericConversionComplete<int16_t>(input);
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(*a, -7629);
+
+    const std::string bad("FF3q");
+    EXPECT_FALSE(tryNumericConversion<double>(bad).has_value());
+}
+
+TEST(stringconversion, c_locale_syntax_test)
+{
+    EXPECT_EQ(numeric_conversion<int>("+457", -1), 457);
+    EXPECT_EQ(numeric_conversion<int>("\t 457", -1), 457);
+    EXPECT_EQ(numeric_conversion<int>("+-457", -1), -1);
+    EXPECT_DOUBLE_EQ(numeric_conversion<double>(" +2.5e2", -1.0), 250.0);
+    EXPECT_DOUBLE_EQ(numeric_conversion<double>("0x1.8p3", -1.0), 12.0);
+    EXPECT_DOUBLE_EQ(numeric_conversion<double>("-0x10", -1.0), -16.0);
+    EXPECT_DOUBLE_EQ(numeric_conversionComplete<double>("0x", -1.0), -1.0);
+    EXPECT_EQ(numeric_conversion<uint32_t>("-1", 0U), 0xFFFFFFFFU);
+
+    size_t rem{0};
+    auto val = numConvComp<double>("  12.5ms", rem);
+    EXPECT_DOUBLE_EQ(val, 12.5);
+    EXPECT_EQ(rem, 6U);
+}
+
+TEST(stringconversion, locale_independence_test)
+{
+    const char* previous = std::setlocale(LC_NUMERIC, nullptr);
+    const std::string previousLocale = (previous != nullptr) ? previous : "C";
+    bool localeSet{false};
+    for (const char* testLocale :
+         {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "de_DE"}) {
+        if (std::setlocale(LC_NUMERIC, testLocale) != nullptr) {
+            localeSet = true;
+            break;
+        }
+    }
+    if (!localeSet) {
+        GTEST_SKIP() << "no locale with a ',' decimal separator available";
+    }
+    const double closeDef = 0.0000000001;
+    EXPECT_NEAR(
+        numeric_conversion<double>("234.123131", -1), 234.123131, closeDef);
+    EXPECT_NEAR(
+        numeric_conversionComplete<double>("-23E-2", 0), -0.23, closeDef);
+    EXPECT_EQ(numeric_conversionComplete<double>("234,5", -1.0), -1.0);
+    std::setlocale(LC_NUMERIC, previousLocale.c_str());
+}
+
+TEST(stringconversion, utf8_input_test)
+{
+    const std::string bom{"\xEF\xBB\xBF"};
+    const std::string nbsp{"\xC2\xA0"};
+    EXPECT_EQ(numeric_conversion<int>(bom + "457", -1), 457);
+    EXPECT_EQ(numeric_conversion<int>(nbsp + "+457", -1), 457);
+    EXPECT_EQ(numeric_conversionComplete<int>("457" + nbsp, -1), 457);
+    EXPECT_EQ(
+        numeric_conversionComplete<int>(
+            std::string("\xEF\xBC\x94\xEF\xBC\x95\xEF\xBC\x97"), -1),
+        457);
+    EXPECT_NEAR(
+        numeric_conversionComplete<double>(
+            bom + "\xE2\x88\x92" "2.5\xEF\xBD\x85" "2" + nbsp, 0.0),
+        -250.0,
+        1e-12);
+    EXPECT_EQ(numeric_conversion<int>(std::string("15\xC2\xB5s"), -1), 15);
+    EXPECT_EQ(
+        numeric_conversionComplete<int>(std::string("15\xC2\xB5s"), -1), -1);
+}
@@ -17,6 +17,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <iterator>
+#include <system_error>
 #include <type_traits>
 #include <vector>
 
@@ -184,3 +186,151 @@ TEST(strViewconversion, simple_floating_point_conversionsComplete)
     auto h = numeric_conversionComplete("-FF3q45", 18.7);
     EXPECT_NEAR(h, 18.7, closeDef);
 }
+
+TEST(strViewconversion, try_numeric_conversion)
+{
+    auto a = tryNumericConversion<int>("457");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(*a, 457);
+
+    EXPECT_FALSE(tryNumericConversion<int>("FF3q").has_value());
+    EXPECT_FALSE(tryNumericConversion<int>("-Bad").has_value());
+    EXPECT_FALSE(tryNumericConversion<int>("").has_value());
+    EXPECT_FALSE(tryNumericConversion<int8_t>("1000").has_value());
+
+    auto b = tryNumericConversion<unsigned int>("-1");
+    ASSERT_TRUE(b.has_value());
+    EXPECT_EQ(*b, static_cast<unsigned int>(-1));
+
+    auto c = tryNumericConversion<double>("-23E-2xyz");
+    ASSERT_TRUE(c.has_value());
+    EXPECT_NEAR(*c, -0.23, 1e-12);
+
+    EXPECT_FALSE(tryNumericConversion<double>("1e999").has_value());
+}
+
+TEST(strViewconversion, try_numeric_conversion_complete)
+{
+    auto a = tryNumericConversionComplete<int>(" 000987  ");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(*a, 987);
+
+    EXPECT_FALSE(tryNumericConversionComplete<uint32_t>("978F9").has_value());
+    EXPECT_FALSE(tryNumericConversionComplete<double>("-456.234g"));
+
+    auto b = tryNumericConversionComplete<double>("45.456e27\t");
+    ASSERT_TRUE(b.has_value());
+    EXPECT_DOUBLE_EQ(*b, 45.456e27);
+}
+
+TEST(strViewconversion, try_num_conv_result)
+{
+    auto a = tryNumConv<int>("  0045abc");
+    EXPECT_TRUE(a);
+    EXPECT_EQ(a.value, 45);
+    EXPECT_EQ(a.charactersUsed, 6U);
+
+    auto b = tryNumConv<int>("abc");
+    EXPECT_FALSE(b);
+    EXPECT_EQ(b.ec, std::errc::invalid_argument);
+    EXPECT_EQ(b.charactersUsed, 0U);
+
+    auto c = tryNumConv<int16_t>("70000");
+    EXPECT_FALSE(c);
+    EXPECT_EQ(c.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(c.charactersUsed, 5U);
+
+    auto d = tryNumConv<float>("1.5e3 ms");
+    EXPECT_TRUE(d);
+    EXPECT_EQ(d.value, 1500.0F);
+    EXPECT_EQ(d.charactersUsed, 5U);
+
+    EXPECT_THROW(numeric_conversion<int16_t>("70000", 0), std::out_of_range);
+}
+
+TEST(strViewconversion, constexpr_integer_conversion)
+{
+    static_assert(strViewToInteger<int64_t>("12345") == 12345);
+    static_assert(strViewToInteger<int>("-2147483648") == INT32_MIN);
+    static_assert(strViewToInteger<uint16_t>("  0065535") == 65535U);
+    static_assert(numConv<int>("-457") == -457);
+    static_assert(numeric_conversion<int>("abc", -1) == -1);
+    static_assert(numeric_conversionComplete<int>("45 ", -1) == 45);
+    static_assert(numeric_conversionComplete<int>("45a", -1) == -1);
+    static_assert(!tryNumConv<int8_t>("128"));
+    static_assert(tryNumConv<int8_t>("128").charactersUsed == 3U);
+    static_assert(tryNumConv<uint32_t>("4294967295").value == UINT32_MAX);
+
+    constexpr auto a = tryNumConv<int>("  0045abc");
+    static_assert(a.value == 45 && a.charactersUsed == 6U);
+    EXPECT_EQ(tryNumConv<int>("  0045abc").value, a.value);
+}
+
+TEST(strViewconversion, constexpr_float_conversion)
+{
+    static_assert(strViewToFloat<double>("1.5") == 1.5);
+    static_assert(numConv<double>("-0.1") == -0.1);
+    static_assert(numConv<float>("0.1") == 0.1F);
+    static_assert(numConv<double>("1.5e3") == 1500.0);
+    static_assert(numConv<double>("6.02214076e23") == 6.02214076e23);
+    static_assert(numConv<double>("123456789012345e5") == 1.23456789012345e19);
+    static_assert(numeric_conversion<double>("45.6 ms", -1.0) == 45.6);
+    static_assert(numeric_conversionComplete<double>("45.6 ms", -1.0) == -1.0);
+    static_assert(numConv<double>("-inf") < -1e308);
+    static_assert(numConv<double>("nan") != numConv<double>("nan"));
+
+    constexpr auto b = tryNumConv<double>("3.25e-2xyz");
+    static_assert(b.charactersUsed == 7U);
+    static_assert(tryNumConv<double>("2.5e").charactersUsed == 3U);
+    static_assert(tryNumConv<double>(".e5").ec == std::errc::invalid_argument);
+
+    // compile time and run time conversions give identical results
+    constexpr double values[] = {
+        numConv<double>("0.3"),
+        numConv<double>("123.456"),
+        numConv<double>("900719925474099e-10"),
+        numConv<double>("1e22"),
+        numConv<double>("4.5e-20"),
+        numConv<double>("0.0000000000000000000001"),
+        numConv<double>("1.797693134862315e30")};
+    const char* strings[] = {
+        "0.3",
+        "123.456",
+        "900719925474099e-10",
+        "1e22",
+        "4.5e-20",
+        "0.0000000000000000000001",
+        "1.797693134862315e30"};
+    for (std::size_t ii = 0; ii < std::size(strings); ++ii) {
+        EXPECT_EQ(values[ii], numConv<double>(strings[ii])) << strings[ii];
+    }
+    EXPECT_EQ(b.value, numConv<double>("3.25e-2"));
+}
+
+TEST(strViewconversion, utf8_normalization)
+{
+    EXPECT_EQ(normalizeNumericText("\xEF\xBB\xBF" "12.5"), "12.5");
+    EXPECT_EQ(normalizeNumericText("\xC2\xA0" "7\xC2\xA0"), "7 ");
+    EXPECT_EQ(
+        normalizeNumericText(
+            "\xEF\xBC\x91\xEF\xBC\x92\xEF\xBC\x8E\xEF\xBC\x95"),
+        "12.5");
+    EXPECT_EQ(normalizeNumericText("\xE2\x88\x92" "4\xEF\xBD\x85" "3"), "-4e3");
+    EXPECT_EQ(normalizeNumericText("15\xC2\xB5s"), "15\xC2\xB5s");
+
+    EXPECT_EQ(numeric_conversion<int>("\xEF\xBB\xBF" "457", -1), 457);
+    EXPECT_EQ(numeric_conversion<int>("4\xEF\xBC\x95\xEF\xBC\x97", -1), 457);
+    EXPECT_EQ(numeric_conversion<int>("15\xC2\xB5s", -1), 15);
+    EXPECT_EQ(numeric_conversion<int>("\xC2\xB5", -1), -1);
+    EXPECT_DOUBLE_EQ(
+        numeric_conversionComplete<double>("\xC2\xA0" "2.5e3\xC2\xA0", -1.0),
+        2500.0);
+    EXPECT_DOUBLE_EQ(
+        numeric_conversionComplete<double>("\xE2\x88\x92" "0.5", 1.0), -0.5);
+    EXPECT_EQ(numeric_conversionComplete<int>("12\xC2\xB5", -1), -1);
+    EXPECT_EQ(tryNumericConversion<int>("\xEF\xBC\x8D\xEF\xBC\x93"), -3);
+    EXPECT_FALSE(tryNumericConversionComplete<int>("3\xE2\x80\x89" "5"));
+    EXPECT_THROW(
+        numeric_conversion<int16_t>("\xEF\xBB\xBF" "70000", 0),
+        std::out_of_range);
+}
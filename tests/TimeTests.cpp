@@ -11,6 +11,10 @@ All rights reserved. SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include "gmlc/utilities/timeRepresentation.hpp"
+#include "gmlc/utilities/timeStringOps.hpp"
+#include "gmlc/utilities/unitParsing.hpp"
+
+#include <stdexcept>
 
 using Time9 = TimeRepresentation<count_time<9>>;
 using Time6 = TimeRepresentation<count_time<6>>;
@@ -509,3 +513,62 @@ TEST(time12, chrono)
 
     EXPECT_TRUE(b2.to_ns() == tmns);
 }
+
+TEST(timeString, getTimeValue)
+{
+    using gmlc::utilities::getTimeValue;
+    EXPECT_DOUBLE_EQ(getTimeValue("1.234"), 1.234);
+    EXPECT_DOUBLE_EQ(getTimeValue("1032ms"), 1.032);
+    EXPECT_DOUBLE_EQ(getTimeValue("15 min"), 900.0);
+    EXPECT_DOUBLE_EQ(getTimeValue("2.5MS"), 0.0025);
+    EXPECT_DOUBLE_EQ(getTimeValue(" 3 Hours "), 10800.0);
+    EXPECT_DOUBLE_EQ(getTimeValue("10423425 ns"), 0.010423425);
+    EXPECT_DOUBLE_EQ(getTimeValue("12", time_units::ms), 0.012);
+    EXPECT_THROW(getTimeValue("12 fortnights"), std::invalid_argument);
+    EXPECT_THROW(getTimeValue("ms"), std::invalid_argument);
+
+    EXPECT_EQ(gmlc::utilities::timeUnitsFromString(" Sec"), time_units::sec);
+    EXPECT_EQ(gmlc::utilities::timeUnitsFromString("wk"), time_units::week);
+    EXPECT_THROW(
+        gmlc::utilities::timeUnitsFromString("lightyear"),
+        std::invalid_argument);
+
+    EXPECT_EQ(
+        gmlc::utilities::loadTimeFromString<Time9>("100 ms"), Time9(0.1));
+}
+
+namespace {
+enum class powerUnit { W, kW, MW, mW };
+}  // namespace
+
+TEST(timeString, unitTable)
+{
+    using gmlc::utilities::makeUnitTable;
+    using gmlc::utilities::tryNumberWithUnits;
+    static constexpr auto powerUnits = makeUnitTable<powerUnit>(
+        {{"W", powerUnit::W},
+         {"kW", powerUnit::kW},
+         {"MW", powerUnit::MW},
+         {"mW", powerUnit::mW}});
+    static_assert(powerUnits.find("kw") == powerUnit::kW);
+    static_assert(powerUnits.find("MW") == powerUnit::MW);
+    static_assert(powerUnits.find("mW") == powerUnit::mW);
+    static_assert(!powerUnits.find("GW").has_value());
+
+    auto res = tryNumberWithUnits<double>("2.5MW", powerUnits, powerUnit::W);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(res.value, 2.5);
+    EXPECT_EQ(res.units, powerUnit::MW);
+
+    res = tryNumberWithUnits<double>("17", powerUnits, powerUnit::kW);
+    EXPECT_TRUE(res);
+    EXPECT_EQ(res.units, powerUnit::kW);
+
+    res = tryNumberWithUnits<double>("17 GW", powerUnits, powerUnit::kW);
+    EXPECT_FALSE(res);
+    EXPECT_EQ(res.unitString, "GW");
+
+    res = tryNumberWithUnits<double>("GW", powerUnits, powerUnit::kW);
+    EXPECT_FALSE(res);
+    EXPECT_TRUE(res.unitString.empty());
+}
@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/vectorCompare.hpp"
+
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+TEST(vectorCompare, tolerances)
+{
+    const std::vector<double> reference{1.0, 100.0, 0.0, -5.0, 2.0};
+    const std::vector<double> values{1.0, 100.5, 0.001, -5.0, 2.2};
+
+    ToleranceOptions options;
+    options.absoluteTolerance = 0.01;
+    auto report = compareWithTolerance(reference, values, options);
+    EXPECT_EQ(report.compared, 5U);
+    EXPECT_EQ(report.mismatches, 2U);
+    EXPECT_FALSE(report.passed());
+    EXPECT_EQ(report.mismatches, countDiffs(reference, values, 0.01));
+    EXPECT_DOUBLE_EQ(report.sumAbsDiff, compareVec(reference, values));
+    EXPECT_EQ(report.maxAbsDiff, 0.5);
+    EXPECT_EQ(report.maxAbsDiffIndex, 1U);
+    EXPECT_NEAR(report.maxRelDiff, 0.1, 1e-12);
+    EXPECT_EQ(report.maxRelDiffIndex, 4U);
+    ASSERT_EQ(report.firstMismatches.size(), 2U);
+    EXPECT_EQ(report.firstMismatches[0].index, 1U);
+    EXPECT_EQ(report.firstMismatches[0].reference, 100.0);
+    EXPECT_EQ(report.firstMismatches[0].value, 100.5);
+    EXPECT_EQ(report.firstMismatches[1].index, 4U);
+
+    // the relative tolerance accepts the large value, as countDiffs does
+    options.relativeTolerance = 0.01;
+    report = compareWithTolerance(reference, values, options);
+    EXPECT_EQ(report.mismatches, 1U);
+    EXPECT_EQ(report.mismatches, countDiffs(reference, values, 0.01, 0.01));
+
+    options.relativeTolerance = 0.2;
+    options.absoluteTolerance = 0.0;
+    EXPECT_EQ(compareWithTolerance(reference, values, options).mismatches, 1U);
+    options.ignoreZeroReference = true;
+    EXPECT_TRUE(compareWithTolerance(reference, values, options).passed());
+
+    // values present in only one input count as mismatches
+    const std::vector<double> longer{1.0, 100.0, 0.0, -5.0, 2.0, 7.0};
+    EXPECT_EQ(compareWithTolerance(reference, longer).mismatches, 1U);
+}
+
+TEST(vectorCompare, largeInputsAndHistogram)
+{
+    std::vector<double> reference(5000);
+    std::iota(reference.begin(), reference.end(), 1.0);
+    auto values = reference;
+    values[17] += 1e-12;
+    values[1500] += 3e-6;
+    values[2500] = std::numeric_limits<double>::quiet_NaN();
+    values[4999] -= 25.0;
+    for (std::size_t ii = 3000; ii < 3020; ++ii) {
+        values[ii] += 0.5;
+    }
+
+    ToleranceOptions options;
+    options.absoluteTolerance = 1e-9;
+    options.recordedMismatches = 3;
+    options.minimumExponent = -13;
+    options.maximumExponent = 2;
+    const auto report = compareWithTolerance(reference, values, options);
+    EXPECT_EQ(report.mismatches, 23U);
+    ASSERT_EQ(report.firstMismatches.size(), 3U);
+    EXPECT_EQ(report.firstMismatches[0].index, 1500U);
+    EXPECT_TRUE(std::isnan(report.firstMismatches[1].value));
+    EXPECT_EQ(report.firstMismatches[2].index, 3000U);
+    EXPECT_EQ(report.maxAbsDiff, 25.0);
+    EXPECT_EQ(report.maxAbsDiffIndex, 4999U);
+
+    ASSERT_EQ(report.histogram.size(), 18U);
+    EXPECT_EQ(report.histogram[0], 5000U - 23U - 1U);
+    // 1e-12 lands in the decade starting at 1e-13 or 1e-12 from rounding
+    EXPECT_EQ(report.histogram[2] + report.histogram[3], 1U);
+    EXPECT_EQ(report.histogram[9], 1U);  // 3e-6
+    EXPECT_EQ(report.histogram[14], 20U);  // 0.5
+    EXPECT_EQ(report.histogram[16], 1U);  // 25
+    EXPECT_EQ(report.histogram[17], 1U);  // NaN
+    EXPECT_EQ(
+        std::accumulate(report.histogram.begin(), report.histogram.end(), 0U),
+        5000U);
+
+    options.histogram = false;
+    EXPECT_TRUE(compareWithTolerance(reference, values, options)
+                    .histogram.empty());
+}
@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/vectorExpressions.hpp"
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+TEST(vectorExpressions, matchesChainedOperations)
+{
+    const std::vector<double> a{1.0, 2.0, 3.0, 4.0, 5.0};
+    const std::vector<double> b{0.5, -1.0, 2.0, 0.0, 3.0};
+    const std::vector<double> c{2.0, 2.0, -2.0, 1.0, 0.25};
+    const std::vector<double> d{1.0, 0.0, 1.0, -3.0, 4.0};
+
+    std::vector<double> ab;
+    std::vector<double> cd;
+    vectorMult(a, b, ab);
+    vectorMult(c, d, cd);
+    vectorAdd(ab, cd);
+
+    std::vector<double> fused;
+    EXPECT_EQ(
+        evaluate(
+            fused,
+            expression(a) * expression(b) + expression(c) * expression(d)),
+        a.size());
+    EXPECT_EQ(fused, ab);
+
+    std::vector<double> multAdd(a.size());
+    vectorMultAdd(a, b, 2.5, multAdd);
+    evaluate(fused, expression(a) + 2.5 * expression(b));
+    EXPECT_EQ(fused, multAdd);
+
+    evaluate(fused, -(expression(a) - 1.0) / 2.0);
+    EXPECT_EQ(fused, (std::vector<double>{0.0, -0.5, -1.0, -1.5, -2.0}));
+}
+
+TEST(vectorExpressions, sizesAndAliasing)
+{
+    std::vector<double> a{1.0, 2.0, 3.0, 4.0};
+    const std::vector<double> shorter{10.0, 20.0};
+
+    // the result has the size of the smallest input
+    std::vector<double> out;
+    evaluate(out, expression(a) + expression(shorter));
+    EXPECT_EQ(out, (std::vector<double>{11.0, 22.0}));
+
+    // only the first elements of a span output are written
+    std::vector<double> partial(3, -1.0);
+    EXPECT_EQ(
+        evaluate(std::span<double>(partial).first(2), 2.0 * expression(a)),
+        2U);
+    EXPECT_EQ(partial, (std::vector<double>{2.0, 4.0, -1.0}));
+
+    // updating an input in place
+    evaluate(a, expression(a) * expression(a) - 1.0);
+    EXPECT_EQ(a, (std::vector<double>{0.0, 3.0, 8.0, 15.0}));
+
+    // a scalar takes the value type of the expression
+    const std::vector<float> floats{1.5F, 2.5F};
+    auto scaled = 0.5 * expression(floats);
+    static_assert(std::is_same_v<decltype(scaled)::value_type, float>);
+    std::vector<float> floatOut;
+    evaluate(floatOut, scaled);
+    EXPECT_EQ(floatOut, (std::vector<float>{0.75F, 1.25F}));
+}
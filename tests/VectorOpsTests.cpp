@@ -0,0 +1,596 @@
+/*
+Copyright (c) 2017-2026,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance
+for Sustainable Energy, LLC.  See the top-level NOTICE for additional details.
+All rights reserved. SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gmlc/utilities/vectorOps.hpp"
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace gmlc::utilities;
+
+namespace {
+const std::vector<double> values{3.0, -7.5, 2.0, 0.5, -1.0, 4.0, 7.5};
+
+template<class X>
+std::vector<X> randomValues(std::size_t count, unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    std::vector<X> result(count);
+    for (auto& value : result) {
+        value = static_cast<X>(dist(gen)) / X(8);
+    }
+    return result;
+}
+}  // namespace
+
+TEST(vectorOps, spanReductionsMatchVectors)
+{
+    const std::span<const double> view(values);
+    EXPECT_DOUBLE_EQ(sum(view), sum(values));
+    EXPECT_DOUBLE_EQ(sum(view), 8.5);
+    EXPECT_DOUBLE_EQ(mean(view), 8.5 / 7.0);
+    EXPECT_DOUBLE_EQ(absSum(view), 25.5);
+    EXPECT_DOUBLE_EQ(absMax(view), 7.5);
+    EXPECT_DOUBLE_EQ(absMin(view), 0.5);
+    EXPECT_DOUBLE_EQ(absMin(values), 0.5);
+    EXPECT_EQ(absMaxLoc(view), std::make_pair(7.5, 1));
+    EXPECT_EQ(absMinLoc(values), std::make_pair(0.5, 3));
+    EXPECT_EQ(maxLoc(view), std::make_pair(7.5, 6));
+    EXPECT_EQ(minLoc(values), std::make_pair(-7.5, 1));
+    EXPECT_DOUBLE_EQ(product(view), 3.0 * -7.5 * 2.0 * 0.5 * -1.0 * 4.0 * 7.5);
+    EXPECT_DOUBLE_EQ(product(values), product(view));
+    EXPECT_DOUBLE_EQ(rms(view), rms(values));
+    EXPECT_DOUBLE_EQ(stdev(view), stdev(values));
+    EXPECT_DOUBLE_EQ(median(view), 2.0);
+    EXPECT_EQ(diff(view), diff(values));
+
+    // a subrange of memory that is not owned by a vector
+    const std::array<int, 6> raw{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(sum(std::span<const int>(raw).subspan(2, 3)), 12);
+    EXPECT_EQ(maxLoc(std::span<const int>{}).second, -1);
+}
+
+TEST(vectorOps, stridedReductions)
+{
+    // a row major 4x3 matrix
+    const std::vector<double> matrix{
+        1.0, 2.0, -3.0, 4.0, -5.0, 6.0, 7.0, 8.0, 9.0, -10.0, 11.0, 12.0};
+    const StridedSpan<const double> column1(matrix.data() + 1, 4, 3);
+    const std::vector<double> copy{2.0, -5.0, 8.0, 11.0};
+    EXPECT_DOUBLE_EQ(sum(column1), sum(copy));
+    EXPECT_DOUBLE_EQ(mean(column1), mean(copy));
+    EXPECT_DOUBLE_EQ(absSum(column1), absSum(copy));
+    EXPECT_DOUBLE_EQ(absMax(column1), 11.0);
+    EXPECT_DOUBLE_EQ(absMin(column1), 2.0);
+    EXPECT_EQ(minLoc(column1), std::make_pair(-5.0, 1));
+    EXPECT_EQ(absMaxLoc(column1), absMaxLoc(copy));
+    EXPECT_DOUBLE_EQ(rms(column1), rms(copy));
+    EXPECT_DOUBLE_EQ(stdev(column1), stdev(copy));
+    EXPECT_DOUBLE_EQ(product(column1), product(copy));
+
+    std::vector<double> mutableMatrix(matrix);
+    const StridedSpan<double> column0(mutableMatrix.data(), 4, 3);
+    column0[2] = 70.0;
+    EXPECT_DOUBLE_EQ(mutableMatrix[6], 70.0);
+    const StridedSpan<const double> readOnly(column0);
+    EXPECT_DOUBLE_EQ(sum(readOnly), 65.0);
+    EXPECT_EQ(readOnly.stride(), 3U);
+
+    // mutable views are reduced without converting them first
+    EXPECT_DOUBLE_EQ(sum(column0), 65.0);
+    EXPECT_DOUBLE_EQ(mean(column0), mean(readOnly));
+    EXPECT_DOUBLE_EQ(absSum(column0), absSum(readOnly));
+    EXPECT_DOUBLE_EQ(absMax(column0), 70.0);
+    EXPECT_DOUBLE_EQ(absMin(column0), 1.0);
+    EXPECT_EQ(absMaxLoc(column0), std::make_pair(70.0, 2));
+    EXPECT_EQ(absMinLoc(column0), absMinLoc(readOnly));
+    EXPECT_EQ(maxLoc(column0), std::make_pair(70.0, 2));
+    EXPECT_EQ(minLoc(column0), std::make_pair(-10.0, 3));
+    EXPECT_DOUBLE_EQ(product(column0), product(readOnly));
+    EXPECT_DOUBLE_EQ(rms(column0), rms(readOnly));
+    EXPECT_DOUBLE_EQ(stdev(column0), stdev(readOnly));
+    EXPECT_EQ(describe(column0).max, 70.0);
+}
+
+TEST(vectorOps, mutableSpanReductions)
+{
+    std::vector<double> values{3.0, -1.0, 4.0, 1.0, -5.0, 9.0};
+    const std::span<double> view(values);
+    const std::span<const double> readOnly(values);
+    EXPECT_DOUBLE_EQ(sum(view), sum(readOnly));
+    EXPECT_DOUBLE_EQ(
+        sum(view, reduction_order::reassociate),
+        sum(readOnly, reduction_order::reassociate));
+    EXPECT_DOUBLE_EQ(mean(view), mean(readOnly));
+    EXPECT_DOUBLE_EQ(absSum(view), 23.0);
+    EXPECT_DOUBLE_EQ(absSum(view, reduction_order::reassociate), 23.0);
+    EXPECT_DOUBLE_EQ(absMax(view), 9.0);
+    EXPECT_DOUBLE_EQ(absMin(view), 1.0);
+    EXPECT_EQ(absMaxLoc(view), std::make_pair(9.0, 5));
+    EXPECT_EQ(absMinLoc(view), std::make_pair(1.0, 1));
+    EXPECT_EQ(maxLoc(view), std::make_pair(9.0, 5));
+    EXPECT_EQ(minLoc(view), std::make_pair(-5.0, 4));
+    EXPECT_DOUBLE_EQ(product(view), 540.0);
+    EXPECT_DOUBLE_EQ(product(view, reduction_order::reassociate), 540.0);
+    EXPECT_DOUBLE_EQ(rms(view), rms(readOnly));
+    EXPECT_DOUBLE_EQ(rms(view, reduction_order::reassociate), rms(readOnly));
+    EXPECT_DOUBLE_EQ(stdev(view), stdev(readOnly));
+    EXPECT_EQ(describe(view).count, 6U);
+    EXPECT_DOUBLE_EQ(median(view), 2.0);
+    EXPECT_DOUBLE_EQ(quantile(view, 1.0), 9.0);
+    const std::vector<double> probabilities{0.0, 0.5};
+    EXPECT_EQ(
+        quantiles(view, probabilities), (std::vector<double>{-5.0, 2.0}));
+    // the const reductions leave the values in place
+    EXPECT_EQ(values, (std::vector<double>{3.0, -1.0, 4.0, 1.0, -5.0, 9.0}));
+
+    std::array<int, 4> counts{1, 2, 3, 4};
+    EXPECT_EQ(sum(std::span<int>(counts)), 10);
+    EXPECT_EQ(absMax(std::span<int>(counts)), 4);
+}
+
+TEST(vectorOps, spanElementOperations)
+{
+    std::array<double, 4> a{1.0, 2.0, 3.0, 4.0};
+    const std::array<double, 3> b{0.5, 0.5, 0.5};
+    vectorAdd(std::span<double>(a), std::span<const double>(b));
+    EXPECT_EQ(a, (std::array<double, 4>{1.5, 2.5, 3.5, 4.0}));
+    vectorSubtract(std::span<double>(a), std::span<const double>(b));
+    EXPECT_EQ(a, (std::array<double, 4>{1.0, 2.0, 3.0, 4.0}));
+
+    std::array<double, 2> product{};
+    vectorMult(
+        std::span<const double>(a),
+        std::span<const double>(b),
+        std::span<double>(product));
+    EXPECT_EQ(product, (std::array<double, 2>{0.5, 1.0}));
+    std::array<double, 3> result{};
+    vectorMultAdd(
+        std::span<const double>(a),
+        std::span<const double>(b),
+        2.0,
+        std::span<double>(result));
+    EXPECT_EQ(result, (std::array<double, 3>{2.0, 3.0, 4.0}));
+    EXPECT_DOUBLE_EQ(
+        mult_sum(std::span<const double>(a), std::span<const double>(b)),
+        3.0);
+
+    std::vector<double> v1{1.0, 2.0, 3.0};
+    const std::vector<double> v2{1.0, 1.0, 1.0};
+    vectorAdd(v1, v2);
+    EXPECT_EQ(v1, (std::vector<double>{2.0, 3.0, 4.0}));
+    std::vector<double> m;
+    vectorMult(v1, v2, m);
+    EXPECT_EQ(m, v1);
+}
+
+TEST(vectorOps, compareAndCount)
+{
+    const std::vector<double> a{1.0, 2.0, 3.0, 4.0};
+    const std::vector<double> b{1.0, 2.5, 2.0, 4.0, 5.0};
+    // the differences were never written when the loop bound was ii < 0
+    std::vector<double> difference;
+    EXPECT_DOUBLE_EQ(compareVec(a, b, difference), 1.5);
+    EXPECT_EQ(difference, (std::vector<double>{0.0, 0.5, 1.0, 0.0}));
+    EXPECT_DOUBLE_EQ(compareVec(a, b, 2), 0.5);
+
+    std::array<double, 2> shortDiff{};
+    EXPECT_DOUBLE_EQ(
+        compareVec(
+            std::span<const double>(a),
+            std::span<const double>(b),
+            std::span<double>(shortDiff)),
+        0.5);
+    EXPECT_EQ(shortDiff, (std::array<double, 2>{0.0, 0.5}));
+
+    EXPECT_EQ(countDiffs(a, b, 0.1), 3U);
+    EXPECT_EQ(
+        countDiffs(std::span<const double>(a), std::span<const double>(b), 0.7),
+        2U);
+    std::size_t calls{0};
+    std::function<void(std::size_t, double, double)> callback =
+        [&calls](std::size_t /*index*/, double /*v1*/, double /*v2*/) {
+            ++calls;
+        };
+    EXPECT_EQ(countDiffsCallback(a, b, 0.1, callback), 3U);
+    EXPECT_EQ(calls, 2U);
+    EXPECT_EQ(absMaxDiffLoc(a, b), std::make_pair(1.0, 2));
+}
+
+TEST(vectorOps, spanFind)
+{
+    const std::span<const double> view(values);
+    EXPECT_EQ(vecFindgt(view, 2.0), (std::vector<std::size_t>{0, 5, 6}));
+    EXPECT_EQ(vecFindgt(values, 2.0), vecFindgt(view, 2.0));
+    EXPECT_EQ(vecFindlte(view, -1.0), (std::vector<std::size_t>{1, 4}));
+    EXPECT_EQ(vecFindeq(view, 2.0), (std::vector<std::size_t>{2}));
+    EXPECT_EQ(
+        (vecFindlt<double, int>(view, 0.0)), (std::vector<int>{1, 4}));
+    EXPECT_EQ(vecFindne(view, 3.0, 0, 2), (std::vector<std::size_t>{1}));
+    EXPECT_EQ(
+        (vecFindne<double, int>(view, 3.0, 0, 2)), (std::vector<int>{1, 2}));
+    EXPECT_EQ(
+        vecFindOp(view, std::function<bool(double)>([](double value) {
+                      return value < 0.0;
+                  })),
+        (std::vector<std::size_t>{1, 4}));
+}
+
+TEST(vectorOps, spanInterpolation)
+{
+    const std::array<double, 3> time{0.0, 1.0, 2.0};
+    const std::array<double, 3> value{0.0, 10.0, 30.0};
+    const std::array<double, 3> timeOut{0.5, 1.5, 3.0};
+    const auto out = interpolateLinear(
+        std::span<const double>(time),
+        std::span<const double>(value),
+        std::span<const double>(timeOut));
+    EXPECT_EQ(out, (std::vector<double>{5.0, 20.0, 50.0}));
+
+    std::array<double, 5> unsorted{5.0, 1.0, 4.0, 2.0, 3.0};
+    EXPECT_DOUBLE_EQ(medianReorder(std::span<double>(unsorted)), 3.0);
+    const auto converted =
+        vectorConvert<int>(std::span<const double>(time));
+    EXPECT_EQ(converted, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(vectorOps, vectorizedReductions)
+{
+    // sizes around the block boundaries exercise the scalar tails
+    for (const std::size_t count : {0U, 1U, 7U, 31U, 32U, 33U, 1000U, 4099U}) {
+        const auto doubles = randomValues<double>(count, 7);
+        const std::span<const double> view(doubles);
+        double expectedMax{0.0};
+        double expectedSum{0.0};
+        for (const double value : doubles) {
+            expectedMax = (std::max)(expectedMax, std::abs(value));
+            expectedSum += value;
+        }
+        EXPECT_EQ(absMax(view), expectedMax);
+        EXPECT_EQ(absMin(view), absMinLoc(view).first);
+        // multiples of 1/8 are summed exactly in any order
+        EXPECT_EQ(sum(view, reduction_order::reassociate), expectedSum);
+        EXPECT_EQ(sum(view, reduction_order::sequential), expectedSum);
+        EXPECT_EQ(
+            absSum(doubles, reduction_order::reassociate),
+            absSum(doubles));
+        EXPECT_DOUBLE_EQ(rms(doubles, reduction_order::reassociate), rms(view));
+
+        const auto floats = randomValues<float>(count, 11);
+        EXPECT_EQ(
+            absMax(std::span<const float>(floats)),
+            absMaxLoc(std::span<const float>(floats)).first);
+        EXPECT_EQ(sum(floats, reduction_order::reassociate), sum(floats));
+
+        std::vector<std::int32_t> ints(count);
+        std::vector<std::int64_t> longs(count);
+        for (std::size_t ii = 0; ii < count; ++ii) {
+            ints[ii] = static_cast<std::int32_t>(doubles[ii] * 8.0);
+            longs[ii] = static_cast<std::int64_t>(ints[ii]) * 1000000;
+        }
+        EXPECT_EQ(sum(ints), static_cast<std::int32_t>(expectedSum * 8.0));
+        EXPECT_EQ(
+            sum(longs), static_cast<std::int64_t>(expectedSum * 8000000.0));
+        EXPECT_EQ(absMax(ints), static_cast<std::int32_t>(expectedMax * 8.0));
+        EXPECT_EQ(absMin(longs), absMinLoc(longs).first);
+        EXPECT_EQ(
+            absSum(ints),
+            static_cast<std::int32_t>(absSum(doubles) * 8.0));
+    }
+}
+
+TEST(vectorOps, vectorizedProductAndNaN)
+{
+    std::vector<double> factors(37, 1.0);
+    factors[3] = 2.0;
+    factors[20] = -0.5;
+    factors[36] = 8.0;
+    EXPECT_EQ(product(factors, reduction_order::reassociate), -8.0);
+    EXPECT_EQ(product(factors), -8.0);
+    std::vector<std::int32_t> ints(40, 1);
+    ints[0] = 3;
+    ints[39] = -2;
+    EXPECT_EQ(product(ints), -6);
+
+    std::vector<double> withNaN(50, 1.0);
+    withNaN[10] = -4.0;
+    withNaN[17] = std::numeric_limits<double>::quiet_NaN();
+    withNaN[30] = 0.25;
+    EXPECT_EQ(absMax(withNaN), 4.0);
+    EXPECT_EQ(absMin(withNaN), 0.25);
+
+    // the kernels and the strided views skip NaN values the same way
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> leadingNaN{nan, 3.0, -5.0, 1.0};
+    const StridedSpan<const double> view(
+        leadingNaN.data(), leadingNaN.size(), 1);
+    EXPECT_EQ(absMin(std::span<const double>(leadingNaN)), 1.0);
+    EXPECT_EQ(absMin(view), 1.0);
+    EXPECT_EQ(absMax(std::span<const double>(leadingNaN)), 5.0);
+    EXPECT_EQ(absMax(view), 5.0);
+    EXPECT_EQ(absMinLoc(leadingNaN), std::make_pair(1.0, 3));
+    EXPECT_EQ(absMaxLoc(view), std::make_pair(5.0, 2));
+    EXPECT_EQ(maxLoc(leadingNaN), std::make_pair(3.0, 1));
+    EXPECT_EQ(minLoc(view), std::make_pair(-5.0, 2));
+
+    const std::vector<float> onlyNaN(
+        20, std::numeric_limits<float>::quiet_NaN());
+    const StridedSpan<const float> nanView(onlyNaN.data(), 10, 2);
+    EXPECT_EQ(absMin(onlyNaN), 0.0F);
+    EXPECT_EQ(absMin(nanView), 0.0F);
+    EXPECT_EQ(absMax(onlyNaN), 0.0F);
+    EXPECT_EQ(absMax(nanView), 0.0F);
+    EXPECT_EQ(minLoc(onlyNaN), std::make_pair(0.0F, -1));
+    EXPECT_EQ(absMaxLoc(nanView), std::make_pair(0.0F, -1));
+}
+
+TEST(vectorOps, describe)
+{
+    const auto empty = describe(std::vector<double>{});
+    EXPECT_EQ(empty.count, 0U);
+    EXPECT_EQ(empty.sum, 0.0);
+
+    const auto small = describe(values);
+    EXPECT_EQ(small.count, values.size());
+    EXPECT_DOUBLE_EQ(small.sum, sum(values));
+    EXPECT_DOUBLE_EQ(small.mean, mean(values));
+    EXPECT_DOUBLE_EQ(small.stdev, stdev(values));
+    EXPECT_DOUBLE_EQ(small.variance, small.stdev * small.stdev);
+    EXPECT_DOUBLE_EQ(small.rms, rms(values));
+    EXPECT_EQ(small.min, -7.5);
+    EXPECT_EQ(small.max, 7.5);
+    EXPECT_EQ(small.absMax, 7.5);
+    EXPECT_EQ(small.absMaxIndex, 1U);
+
+    // several blocks with the largest value in the last one and a large
+    // offset that a naive sum of squares would lose
+    std::mt19937 gen(43);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> data(1000);
+    for (auto& value : data) {
+        value = 1.0e6 + dist(gen);
+    }
+    data[917] = 1.0e6 + 3.0;
+    data[933] = 1.0e6 + 3.0;
+    const auto large = describe(data);
+    EXPECT_EQ(large.count, data.size());
+    EXPECT_NEAR(large.mean, mean(data), 1e-9);
+    EXPECT_NEAR(large.stdev, stdev(data), 1e-9);
+    EXPECT_NEAR(large.sum, sum(data), 1e-6);
+    EXPECT_EQ(large.max, 1.0e6 + 3.0);
+    EXPECT_EQ(large.absMaxIndex, 917U);
+    EXPECT_EQ(
+        large.absMaxIndex,
+        static_cast<std::size_t>(absMaxLoc(data).second));
+
+    const auto strided = describe(StridedSpan<const double>(data.data(), 3, 2));
+    EXPECT_EQ(strided.count, 3U);
+    EXPECT_DOUBLE_EQ(strided.min, (std::min)({data[0], data[2], data[4]}));
+
+    std::vector<float> floats(data.size());
+    for (std::size_t ii = 0; ii < data.size(); ++ii) {
+        floats[ii] = static_cast<float>(data[ii] - 1.0e6);
+    }
+    const auto single = describe(floats);
+    EXPECT_NEAR(single.stdev, stdev(floats), 1e-5F);
+    EXPECT_EQ(single.absMaxIndex, 917U);
+}
+
+TEST(vectorOps, summaryAccumulatorMerge)
+{
+    std::vector<double> data(777);
+    for (std::size_t ii = 0; ii < data.size(); ++ii) {
+        data[ii] = std::sin(static_cast<double>(ii)) * 10.0;
+    }
+    const auto whole = describe(data);
+
+    // accumulate the pieces separately in different ways and merge in order
+    const std::span<const double> view(data);
+    SummaryAccumulator<double> first;
+    SummaryAccumulator<double> second;
+    SummaryAccumulator<double> third;
+    first.add(view.first(300));
+    for (std::size_t ii = 300; ii < 301; ++ii) {
+        second.add(data[ii]);
+    }
+    second.add(view.subspan(301, 200));
+    third.add(view.subspan(501));
+    first.merge(second);
+    first.merge(third);
+    EXPECT_EQ(first.count(), data.size());
+    const auto merged = first.summary();
+    EXPECT_EQ(merged.count, whole.count);
+    EXPECT_NEAR(merged.sum, whole.sum, 1e-10);
+    EXPECT_NEAR(merged.mean, whole.mean, 1e-12);
+    EXPECT_NEAR(merged.variance, whole.variance, 1e-10);
+    EXPECT_NEAR(merged.rms, whole.rms, 1e-10);
+    EXPECT_EQ(merged.min, whole.min);
+    EXPECT_EQ(merged.max, whole.max);
+    EXPECT_EQ(merged.absMax, whole.absMax);
+    EXPECT_EQ(merged.absMaxIndex, whole.absMaxIndex);
+
+    first.clear();
+    EXPECT_EQ(first.count(), 0U);
+}
+
+TEST(vectorOps, parallelOperations)
+{
+    std::mt19937 gen(44);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> a(10007);
+    std::vector<double> b(a.size());
+    for (std::size_t ii = 0; ii < a.size(); ++ii) {
+        a[ii] = dist(gen);
+        b[ii] = (ii % 3 == 0) ? a[ii] + dist(gen) * 0.01 : a[ii];
+    }
+    ParallelOptions single;
+    single.threads = 1;
+    single.blockSize = 1000;
+    const double sumSingle = sum(a, single);
+    const double compareSingle = compareVec(a, b, single);
+    EXPECT_NEAR(sumSingle, sum(a), 1e-10);
+    EXPECT_NEAR(compareSingle, compareVec(a, b), 1e-12);
+    EXPECT_EQ(countDiffs(a, b, 0.005, single), countDiffs(a, b, 0.005));
+
+    // the reductions only depend on the block size
+    for (unsigned int threads : {2U, 3U, 4U, 16U}) {
+        ParallelOptions options = single;
+        options.threads = threads;
+        EXPECT_EQ(sum(a, options), sumSingle);
+        EXPECT_EQ(compareVec(a, b, options), compareSingle);
+        EXPECT_EQ(countDiffs(a, b, 0.005, options), countDiffs(a, b, 0.005));
+
+        auto added = a;
+        vectorAdd(added, b, options);
+        auto expected = a;
+        vectorAdd(expected, b);
+        EXPECT_EQ(added, expected);
+
+        vectorSubtract(added, b, options);
+        vectorSubtract(expected, b);
+        EXPECT_EQ(added, expected);
+
+        std::vector<double> result(a.size());
+        vectorMultAdd(a, b, 2.5, result, options);
+        vectorMultAdd(a, b, 2.5, expected);
+        EXPECT_EQ(result, expected);
+    }
+    std::vector<double> shorter(a.begin(), a.begin() + 5000);
+    EXPECT_EQ(
+        countDiffs(a, shorter, 0.5, single), countDiffs(a, shorter, 0.5));
+    EXPECT_EQ(sum(std::vector<double>{}, ParallelOptions{}), 0.0);
+}
+
+TEST(vectorOps, quantiles)
+{
+    EXPECT_EQ(median(values), 2.0);
+    EXPECT_EQ(median(std::vector<double>{4.0, 1.0, 3.0, 2.0}), 2.5);
+    EXPECT_EQ(quantile(values, 0.0), -7.5);
+    EXPECT_EQ(quantile(values, 1.0), 7.5);
+    EXPECT_EQ(quantile(values, 0.5), median(values));
+    // linear interpolation between the closest ranks
+    EXPECT_DOUBLE_EQ(quantile(values, 0.25), -0.25);
+
+    std::mt19937 gen(45);
+    std::uniform_real_distribution<double> dist(0.0, 100.0);
+    std::vector<double> data(1001);
+    for (auto& value : data) {
+        value = dist(gen);
+    }
+    auto sorted = data;
+    std::sort(sorted.begin(), sorted.end());
+    const std::vector<double> probabilities{0.99, 0.5, 0.01, 0.25, 0.75, 0.5};
+    const auto results = quantiles(data, probabilities);
+    ASSERT_EQ(results.size(), probabilities.size());
+    for (std::size_t ii = 0; ii < probabilities.size(); ++ii) {
+        const double position = probabilities[ii] * 1000.0;
+        const auto rank = static_cast<std::size_t>(position);
+        const double expected = sorted[rank] +
+            (position - static_cast<double>(rank)) *
+                (sorted[rank + 1] - sorted[rank]);
+        EXPECT_NEAR(results[ii], expected, 1e-9) << probabilities[ii];
+    }
+
+    // the in place version writes into caller storage
+    auto scratch = data;
+    std::vector<double> output(probabilities.size());
+    quantilesReorder(
+        std::span<double>(scratch),
+        std::span<const double>(probabilities),
+        std::span<double>(output));
+    EXPECT_EQ(output, results);
+    EXPECT_EQ(quantile(std::vector<double>{}, 0.5), 0.0);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW(quantile(values, nan), std::invalid_argument);
+    EXPECT_THROW(
+        quantiles(data, std::vector<double>{0.5, nan}), std::invalid_argument);
+    EXPECT_THROW(quantile(std::vector<double>{}, nan), std::invalid_argument);
+}
+
+TEST(vectorOps, medianSelection)
+{
+    // sorted, reversed, constant and sawtooth inputs of several sizes
+    for (const std::size_t size : {1U, 2U, 16U, 17U, 100U, 1001U, 4096U}) {
+        std::vector<std::vector<int>> inputs(4, std::vector<int>(size));
+        for (std::size_t ii = 0; ii < size; ++ii) {
+            const auto value = static_cast<int>(ii);
+            inputs[0][ii] = value;
+            inputs[1][ii] = static_cast<int>(size) - value;
+            inputs[2][ii] = 7;
+            inputs[3][ii] = value % 5;
+        }
+        for (auto& input : inputs) {
+            auto sorted = input;
+            std::stable_sort(sorted.begin(), sorted.end());
+            const std::size_t middle = size / 2;
+            const double expected = (size % 2 == 1) ?
+                sorted[middle] :
+                0.5 * (sorted[middle] + sorted[middle - 1]);
+            EXPECT_EQ(median(input), static_cast<int>(expected)) << size;
+            EXPECT_EQ(
+                quantile(input, 0.1), sorted[(size - 1) / 10]) << size;
+        }
+    }
+}
+
+TEST(vectorOps, findMasksAndIndices)
+{
+    // several chunks with a partial last word
+    std::vector<double> data(9000);
+    std::vector<std::int32_t> ints(data.size());
+    for (std::size_t ii = 0; ii < data.size(); ++ii) {
+        data[ii] = static_cast<double>((ii * 37) % 101);
+        ints[ii] = static_cast<std::int32_t>(data[ii]);
+    }
+    std::vector<std::size_t> expected;
+    for (std::size_t ii = 0; ii < data.size(); ++ii) {
+        if (data[ii] >= 90.0) {
+            expected.push_back(ii);
+        }
+    }
+    EXPECT_EQ(vecFindgte(data, 90.0), expected);
+    EXPECT_EQ(vecFindgte(ints, 90), expected);
+    EXPECT_EQ(
+        vecFindOp(data, [](double value) { return value >= 90.0; }), expected);
+
+    const auto mask = vecFindMask(data, comparison_op::greater_equal, 90.0);
+    ASSERT_EQ(mask.size(), (data.size() + 63) / 64);
+    EXPECT_EQ(maskIndices(mask), expected);
+    EXPECT_EQ(
+        maskIndices<int>(vecFindMask(ints, comparison_op::greater_equal, 90)),
+        std::vector<int>(expected.begin(), expected.end()));
+
+    // a type without a kernel takes the generic path
+    std::vector<std::int16_t> shorts(ints.begin(), ints.end());
+    EXPECT_EQ(
+        maskIndices(vecFindMask(
+            shorts, comparison_op::greater_equal, std::int16_t{90})),
+        expected);
+    EXPECT_EQ(vecFindgte(shorts, std::int16_t{90}), expected);
+
+    const auto equalMask = vecFindMask(data, comparison_op::equal, 5.0);
+    EXPECT_EQ(maskIndices(equalMask), vecFindeq(data, 5.0));
+    EXPECT_EQ(
+        vecFindne(data, 5.0, 100, 5000).size(),
+        4900U - vecFindeq(std::span<const double>(data).subspan(100, 4900), 5.0)
+                    .size());
+    EXPECT_TRUE(vecFindMask(std::vector<double>{}, comparison_op::less, 0.0)
+                    .empty());
+}